@@ -1,16 +1,129 @@
 #pragma once
 
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/memory.hpp"
 
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace fixed_containers::algorithm_detail
+{
+// Relocation between contiguous ranges of the same trivially relocatable type is a `memmove`
+template <class It1, class It2>
+concept RelocatableWithMemmove =
+    std::contiguous_iterator<It1> && std::contiguous_iterator<It2> &&
+    std::same_as<std::iter_value_t<It1>, std::iter_value_t<It2>> &&
+    TriviallyRelocatable<std::iter_value_t<It1>>;
+
+template <class It1, class It2>
+void relocate_with_memmove(It1 first, const std::iter_difference_t<It1> count, It2 d_first)
+{
+    if (count > 0)
+    {
+        // Cast to `void*` because the type is not necessarily trivially copyable
+        std::memmove(static_cast<void*>(std::to_address(d_first)),
+                     static_cast<const void*>(std::to_address(first)),
+                     static_cast<std::size_t>(count) * sizeof(std::iter_value_t<It1>));
+    }
+}
+
+// Copies between contiguous ranges of the same trivially copyable type are a `memcpy`
+template <class It1, class It2>
+concept CopyableWithMemcpy =
+    std::contiguous_iterator<It1> && std::contiguous_iterator<It2> &&
+    std::same_as<std::iter_value_t<It1>, std::iter_value_t<It2>> &&
+    TriviallyCopyable<std::iter_value_t<It1>>;
+}  // namespace fixed_containers::algorithm_detail
+
 namespace fixed_containers::algorithm
 {
+// Lexicographically compares `count` bytes as `unsigned char`s, like `std::memcmp`, but a word at
+// a time. The first differing byte of two words is located from their XOR.
+inline std::strong_ordering compare_bytes(const void* lhs, const void* rhs, const std::size_t count)
+{
+    const auto* lhs_bytes = static_cast<const unsigned char*>(lhs);
+    const auto* rhs_bytes = static_cast<const unsigned char*>(rhs);
+    constexpr std::size_t WORD_SIZE = sizeof(std::uint64_t);
+
+    std::size_t i = 0;
+    for (; i + WORD_SIZE <= count; i += WORD_SIZE)
+    {
+        std::uint64_t lhs_word{};
+        std::uint64_t rhs_word{};
+        std::memcpy(&lhs_word, std::next(lhs_bytes, static_cast<std::ptrdiff_t>(i)), WORD_SIZE);
+        std::memcpy(&rhs_word, std::next(rhs_bytes, static_cast<std::ptrdiff_t>(i)), WORD_SIZE);
+        const std::uint64_t difference = lhs_word ^ rhs_word;
+        if (difference != 0)
+        {
+            const int bit_index = std::endian::native == std::endian::little
+                                      ? std::countr_zero(difference)
+                                      : std::countl_zero(difference);
+            i += static_cast<std::size_t>(bit_index) / 8;
+            break;
+        }
+    }
+    for (; i < count; i++)
+    {
+        const unsigned char lhs_byte = *std::next(lhs_bytes, static_cast<std::ptrdiff_t>(i));
+        const unsigned char rhs_byte = *std::next(rhs_bytes, static_cast<std::ptrdiff_t>(i));
+        if (lhs_byte != rhs_byte)
+        {
+            return lhs_byte <=> rhs_byte;
+        }
+    }
+    return std::strong_ordering::equal;
+}
+
+// Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_copy
+// Contiguous ranges of trivially copyable types are copied with a `memcpy` at runtime.
+template <class InputIt, class FwdIt>
+constexpr FwdIt uninitialized_copy(InputIt first, InputIt last, FwdIt d_first)
+{
+    if constexpr (algorithm_detail::CopyableWithMemcpy<InputIt, FwdIt>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto count = std::distance(first, last);
+            if (count > 0)
+            {
+                std::memcpy(static_cast<void*>(std::to_address(d_first)),
+                            static_cast<const void*>(std::to_address(first)),
+                            static_cast<std::size_t>(count) * sizeof(std::iter_value_t<InputIt>));
+            }
+            return std::next(d_first, count);
+        }
+    }
+
+    for (; first != last; ++first, ++d_first)
+    {
+        memory::construct_at_address_of(*d_first, *first);
+    }
+    return d_first;
+}
+
 // Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_move
-// but also destroys the source range
+// but also destroys the source range.
+// Contiguous ranges of trivially relocatable types are relocated with a `memmove` at runtime.
 template <class FwdIt1, class FwdIt2>
 constexpr FwdIt2 uninitialized_relocate(FwdIt1 first, FwdIt1 last, FwdIt2 d_first)
 {
+    if constexpr (algorithm_detail::RelocatableWithMemmove<FwdIt1, FwdIt2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto count = std::distance(first, last);
+            algorithm_detail::relocate_with_memmove(first, count, d_first);
+            return std::next(d_first, count);
+        }
+    }
+
     while (first != last)
     {
         memory::construct_at_address_of(*d_first, std::move(*first));
@@ -22,10 +135,22 @@ constexpr FwdIt2 uninitialized_relocate(FwdIt1 first, FwdIt1 last, FwdIt2 d_firs
 }
 
 // Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_move
-// but also destroys the source range
+// but also destroys the source range.
+// Contiguous ranges of trivially relocatable types are relocated with a `memmove` at runtime.
 template <class BidirIt1, class BidirIt2>
 constexpr BidirIt2 uninitialized_relocate_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
+    if constexpr (algorithm_detail::RelocatableWithMemmove<BidirIt1, BidirIt2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto count = std::distance(first, last);
+            const BidirIt2 d_first = std::prev(d_last, count);
+            algorithm_detail::relocate_with_memmove(first, count, d_first);
+            return d_first;
+        }
+    }
+
     while (first != last)
     {
         --d_last;
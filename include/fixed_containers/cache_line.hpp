@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+namespace fixed_containers
+{
+// The size of a cache line, for keeping data written by different threads apart.
+// Fixed instead of `std::hardware_destructive_interference_size`, which may differ between
+// compilations and would then change the layout of a container shared between two processes.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+}  // namespace fixed_containers
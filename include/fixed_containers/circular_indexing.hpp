@@ -4,7 +4,9 @@
 #include "fixed_containers/int_math.hpp"
 #include "fixed_containers/integer_range.hpp"
 
+#include <bit>
 #include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 
@@ -66,4 +68,64 @@ constexpr CyclesAndInteger decrement_index_with_wraparound(const IntegerRangeTyp
     out.cycles -= static_cast<std::int64_t>(negative_cycles);
     return out;
 }
+
+// Wraparound for indices in [0, CAPACITY), with CAPACITY known at compile time. Unlike the
+// functions above, no division is needed: power-of-two capacities wrap with a mask, and other
+// capacities with a single conditional add or subtract when `n <= CAPACITY` (the common case, for
+// example when indexing from the front of a container). Cycles are not computed.
+template <std::size_t CAPACITY>
+constexpr std::size_t wrap_index(const std::size_t index)
+{
+    if constexpr (CAPACITY == 0)
+    {
+        return 0;
+    }
+    else if constexpr (std::has_single_bit(CAPACITY))
+    {
+        return index & (CAPACITY - 1);
+    }
+    else
+    {
+        return index % CAPACITY;
+    }
+}
+
+template <std::size_t CAPACITY>
+constexpr std::size_t increment_index_with_wraparound(const std::size_t index, std::size_t n)
+{
+    if constexpr (CAPACITY == 0 || std::has_single_bit(CAPACITY))
+    {
+        return wrap_index<CAPACITY>(index + n);
+    }
+    else
+    {
+        if (n > CAPACITY) [[unlikely]]
+        {
+            n = wrap_index<CAPACITY>(n);
+        }
+        // Selecting between precomputed values lets the compiler avoid a branch (cmov)
+        const std::size_t unwrapped = index + n;
+        const std::size_t wrapped = unwrapped - CAPACITY;
+        return unwrapped >= CAPACITY ? wrapped : unwrapped;
+    }
+}
+
+template <std::size_t CAPACITY>
+constexpr std::size_t decrement_index_with_wraparound(const std::size_t index, std::size_t n)
+{
+    if constexpr (CAPACITY == 0 || std::has_single_bit(CAPACITY))
+    {
+        return wrap_index<CAPACITY>(index - n);
+    }
+    else
+    {
+        if (n > CAPACITY) [[unlikely]]
+        {
+            n = wrap_index<CAPACITY>(n);
+        }
+        const std::size_t unwrapped = index - n;
+        const std::size_t wrapped = unwrapped + CAPACITY;
+        return index >= n ? unwrapped : wrapped;
+    }
+}
 }  // namespace fixed_containers::circular_indexing
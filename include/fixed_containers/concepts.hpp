@@ -100,6 +100,20 @@ concept TriviallyDestructible = std::is_trivially_destructible_v<T>;
 template <class T>
 concept NotTriviallyDestructible = not TriviallyDestructible<T>;
 
+// A type is trivially relocatable if moving an object to a new address and destroying the original
+// is equivalent to copying its bytes, e.g. when the object holds no pointers into itself.
+// Trivially copyable types are, by default. Other types can opt in by specializing this variable
+// template, for example:
+// template <>
+// inline constexpr bool IS_TRIVIALLY_RELOCATABLE<MyUniqueHandle> = true;
+template <class T>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE = std::is_trivially_copyable_v<T>;
+
+template <class T>
+concept TriviallyRelocatable = IS_TRIVIALLY_RELOCATABLE<std::remove_cv_t<T>>;
+template <class T>
+concept NotTriviallyRelocatable = not TriviallyRelocatable<T>;
+
 template <class T>
 concept Aggregate = std::is_aggregate_v<T>;
 template <class T>
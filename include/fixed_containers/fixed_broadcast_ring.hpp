@@ -0,0 +1,238 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/circular_indexing.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+namespace fixed_containers::fixed_broadcast_ring_detail
+{
+// An element, stored as words that are all accessed atomically so that a reader racing with the
+// writer gets a torn copy instead of undefined behavior; the sequence stamp tells it to discard
+// that copy. The words are stored with release and loaded with acquire ordering, which keeps them
+// between the two stamp accesses on either side without standalone fences. The stamp of the slot
+// holding `position` is:
+//  - `2 * position + 1` while the writer is writing it
+//  - `2 * position + 2` once it is complete
+// and 0 before the slot is first written.
+template <typename T>
+struct Slot
+{
+    using Word = std::size_t;
+    static constexpr std::size_t WORD_COUNT = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    std::atomic<std::size_t> stamp;
+    std::array<std::atomic<Word>, WORD_COUNT> words;
+
+    void store(const T& value)
+    {
+        std::array<Word, WORD_COUNT> buffer{};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < WORD_COUNT; i++)
+        {
+            words[i].store(buffer[i], std::memory_order_release);
+        }
+    }
+
+    [[nodiscard]] T load() const
+    {
+        std::array<Word, WORD_COUNT> buffer{};
+        for (std::size_t i = 0; i < WORD_COUNT; i++)
+        {
+            buffer[i] = words[i].load(std::memory_order_acquire);
+        }
+        std::array<std::byte, sizeof(T)> bytes{};
+        std::memcpy(bytes.data(), buffer.data(), sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+};
+
+constexpr std::size_t writing_stamp(const std::size_t position) { return (2 * position) + 1; }
+constexpr std::size_t complete_stamp(const std::size_t position) { return (2 * position) + 2; }
+// The position that a slot with the given non-zero stamp holds or is being written with
+constexpr std::size_t position_of_stamp(const std::size_t stamp) { return (stamp - 1) / 2; }
+}  // namespace fixed_containers::fixed_broadcast_ring_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity ring with a single writer and any number of readers, each of which sees every
+ * element. When the ring is full the writer overwrites the oldest element, like
+ * `FixedCircularDeque::push_back()`, instead of waiting for the readers. Properties:
+ *  - `publish()` is wait-free and never looks at the readers, so slow readers never stall the
+ *    writer
+ *  - each reader keeps its position in its own `Cursor`; readers do not write to the ring at all
+ *  - a reader that falls more than `MAXIMUM_SIZE` elements behind has been lapped: it skips ahead
+ *    to the oldest element that is still in the ring, and the cursor counts what it missed
+ *  - no pointers stored and no dynamic allocations
+ *
+ * Each slot is a seqlock. The writer marks the slot as being written, writes the element and then
+ * stamps the slot with its position; a reader copies the element and keeps the copy only if the
+ * stamp was the one it expected both before and after copying. Elements are therefore copied as
+ * raw bytes, which restricts them to trivially copyable types.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE>
+class FixedBroadcastRing
+{
+    static_assert(MAXIMUM_SIZE > 0, "The ring must be able to hold at least one element");
+    static_assert(TriviallyCopyable<T>, "Elements are read racily, so they must be copyable bits");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "The ring relies on lock-free atomics");
+
+    using Slot = fixed_broadcast_ring_detail::Slot<T>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /**
+     * A reader's position in the ring. A default-constructed cursor starts at the first element
+     * ever published, and skips ahead like a lapped reader if that has been overwritten already;
+     * `FixedBroadcastRing::make_cursor()` starts at the next element to be published instead.
+     */
+    class Cursor
+    {
+        friend class FixedBroadcastRing;
+
+        std::size_t next_position_{0};
+        std::size_t missed_count_{0};
+
+    public:
+        constexpr Cursor() noexcept = default;
+
+    private:
+        explicit constexpr Cursor(const std::size_t next_position) noexcept
+          : next_position_{next_position}
+        {
+        }
+
+    public:
+        // The position of the next element to be read, counting from the first one published
+        [[nodiscard]] constexpr std::size_t position() const noexcept { return next_position_; }
+        // How many elements were skipped because the writer lapped this reader
+        [[nodiscard]] constexpr std::size_t missed_count() const noexcept { return missed_count_; }
+    };
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    // The number of elements published so far. Only written by the writer.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> write_position_;
+    alignas(CACHE_LINE_SIZE) std::array<Slot, MAXIMUM_SIZE> slots_;
+
+public:
+    FixedBroadcastRing() noexcept
+      : write_position_{0}
+      , slots_{}
+    {
+    }
+
+    FixedBroadcastRing(const FixedBroadcastRing&) = delete;
+    FixedBroadcastRing(FixedBroadcastRing&&) = delete;
+    FixedBroadcastRing& operator=(const FixedBroadcastRing&) = delete;
+    FixedBroadcastRing& operator=(FixedBroadcastRing&&) = delete;
+    ~FixedBroadcastRing() = default;
+
+    /**
+     * Writer only. Add the element, overwriting the oldest one if the ring is full.
+     */
+    void publish(const value_type& value) noexcept
+    {
+        const std::size_t position = write_position_.load(std::memory_order_relaxed);
+        Slot& target = slot(position);
+
+        target.stamp.store(fixed_broadcast_ring_detail::writing_stamp(position),
+                           std::memory_order_relaxed);
+        target.store(value);
+        target.stamp.store(fixed_broadcast_ring_detail::complete_stamp(position),
+                           std::memory_order_release);
+
+        write_position_.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * Any thread. A cursor at the next element to be published, for readers that are only
+     * interested in what comes after they join.
+     */
+    [[nodiscard]] Cursor make_cursor() const noexcept
+    {
+        return Cursor{write_position_.load(std::memory_order_acquire)};
+    }
+
+    /**
+     * Any thread, each with its own cursor. Return the element at the cursor and advance it, or
+     * return `std::nullopt` if that element has not been published yet. If the writer has lapped
+     * the reader, the cursor first skips ahead to the oldest element still in the ring.
+     */
+    std::optional<value_type> try_read(Cursor& cursor) const noexcept
+    {
+        while (true)
+        {
+            const std::size_t position = cursor.next_position_;
+            const Slot& source = slot(position);
+            const std::size_t expected = fixed_broadcast_ring_detail::complete_stamp(position);
+
+            const std::size_t stamp_before = source.stamp.load(std::memory_order_acquire);
+            if (stamp_before < expected)
+            {
+                // Not published yet, or still being written
+                return std::nullopt;
+            }
+            if (stamp_before == expected)
+            {
+                const value_type value = source.load();
+                const std::size_t stamp_after = source.stamp.load(std::memory_order_relaxed);
+                if (stamp_after == expected)
+                {
+                    cursor.next_position_++;
+                    return value;
+                }
+                skip_overwritten(cursor, stamp_after);
+                continue;
+            }
+            skip_overwritten(cursor, stamp_before);
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * The number of elements published so far, including those that have been overwritten.
+     * A snapshot, which may be stale by the time it is used unless called by the writer.
+     */
+    [[nodiscard]] std::size_t published_count() const noexcept
+    {
+        return write_position_.load(std::memory_order_acquire);
+    }
+
+private:
+    Slot& slot(const std::size_t position)
+    {
+        return slots_[circular_indexing::wrap_index<MAXIMUM_SIZE>(position)];
+    }
+    const Slot& slot(const std::size_t position) const
+    {
+        return slots_[circular_indexing::wrap_index<MAXIMUM_SIZE>(position)];
+    }
+
+    // The slot at the cursor has been taken by a later element, whose position is encoded in
+    // `newer_stamp`. The writer is at least at that position, so the oldest element that may still
+    // be intact is the one after the slot it is writing.
+    static void skip_overwritten(Cursor& cursor, const std::size_t newer_stamp) noexcept
+    {
+        const std::size_t newer_position =
+            fixed_broadcast_ring_detail::position_of_stamp(newer_stamp);
+        const std::size_t oldest_intact_position = newer_position - MAXIMUM_SIZE + 1;
+        cursor.missed_count_ += oldest_intact_position - cursor.next_position_;
+        cursor.next_position_ = oldest_intact_position;
+    }
+};
+
+}  // namespace fixed_containers
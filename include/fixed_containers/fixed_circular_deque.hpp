@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
+#include <span>
 #include <utility>
 
 namespace fixed_containers
@@ -69,7 +70,7 @@ public:
                                      std_transition::source_location::current()) noexcept
       : FixedCircularDeque()
     {
-        insert(cend(), first, last, loc);
+        push_back_range(first, last, loc);
     }
 
     constexpr FixedCircularDeque(std::initializer_list<T> list,
@@ -108,6 +109,42 @@ public:
         deque().push_back(std::move(value), loc);
     }
 
+    /**
+     * Appends the elements of [first, last) at the back, evicting elements from the front as
+     * needed. Incoming elements that would be evicted again by the same call are skipped, the
+     * evicted ones are removed with a single `pop_front_n()` and the rest are copied in bulk with
+     * `FixedDeque::push_back_range()`.
+     */
+    template <InputIterator InputIt>
+    constexpr void push_back_range(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto incoming_entry_count = static_cast<std::size_t>(std::distance(first, last));
+            if (incoming_entry_count >= MAXIMUM_SIZE)
+            {
+                clear();
+                std::advance(first,
+                             static_cast<difference_type>(incoming_entry_count - MAXIMUM_SIZE));
+            }
+            else if (incoming_entry_count > available_entries())
+            {
+                deque().pop_front_n(incoming_entry_count - available_entries(), loc);
+            }
+            deque().push_back_range(first, last, loc);
+        }
+        else  // std::input_iterator
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first, loc);
+            }
+        }
+    }
+
     template <class... Args>
     constexpr reference emplace_back(Args&&... args)
     {
@@ -148,6 +185,12 @@ public:
     {
         deque().pop_front(loc);
     }
+    constexpr void pop_front_n(
+        size_type n,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        deque().pop_front_n(n, loc);
+    }
 
     constexpr iterator insert(
         const_iterator pos,
@@ -335,6 +378,12 @@ public:
         return deque().back(loc);
     }
 
+    constexpr std::array<std::span<T>, 2> as_spans() noexcept { return deque().as_spans(); }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        return deque().as_spans();
+    }
+
 private:
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
@@ -357,10 +406,7 @@ private:
             // is treated as an uncrossable barrier
             const std::ptrdiff_t existing_elements_to_be_dropped =
                 (std::min)(excess_entry_count, std::distance(deq.cbegin(), pos));
-            for (std::ptrdiff_t i = 0; i < existing_elements_to_be_dropped; i++)
-            {
-                deq.pop_front(loc);
-            }
+            deq.pop_front_n(static_cast<size_type>(existing_elements_to_be_dropped), loc);
 
             // 2) Drop incoming elements
             const auto incoming_elements_to_be_dropped =
@@ -6,6 +6,10 @@
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
 
+#include <array>
+#include <cstddef>
+#include <span>
+
 namespace fixed_containers
 {
 template <typename T,
@@ -34,6 +38,41 @@ public:
       : Base{first, last, loc}
     {
     }
+
+    /**
+     * Pushes the elements of [first, last), evicting the oldest elements as needed. See
+     * `FixedCircularDeque::push_back_range()`.
+     */
+    template <InputIterator InputIt>
+    constexpr void push_range(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.push_back_range(first, last, loc);
+    }
+
+    /**
+     * Removes the first `n` elements, e.g. after they have been consumed through `as_spans()`.
+     */
+    constexpr void pop_n(
+        std::size_t n,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.pop_front_n(n, loc);
+    }
+
+    /**
+     * The elements from front to back, as (at most) two contiguous segments of the storage.
+     */
+    constexpr std::array<std::span<T>, 2> as_spans() noexcept
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.as_spans();
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.as_spans();
+    }
 };
 
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
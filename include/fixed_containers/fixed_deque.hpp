@@ -20,6 +20,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <type_traits>
 
 namespace fixed_containers::fixed_deque_detail
@@ -38,7 +39,9 @@ inline constexpr std::size_t FIXED_DEQUE_STARTING_OFFSET =
 template <typename T, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
 class FixedDequeBase
 {
-    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+    // Unwrapped for simple types, so that the segments returned by `as_spans()` can be
+    // traversed at compile-time. See the equivalent comment in FixedVector.
+    using OptionalT = optional_storage_detail::OptionalStorageTransparent<T>;
     // std::deque has the following restrictions too
     static_assert(IsNotReference<T>, "References are not allowed");
     static_assert(std::same_as<std::remove_cv_t<T>, T>,
@@ -47,17 +50,25 @@ class FixedDequeBase
     using Array = std::array<OptionalT, MAXIMUM_SIZE>;
     static constexpr StartingIntegerAndDistance FULL_STARTING_INDEX_AND_SIZE{
         .start = 0, .distance = MAXIMUM_SIZE};
-    static constexpr IntegerRange FULL_RANGE = FULL_STARTING_INDEX_AND_SIZE.to_range();
 
     static constexpr std::size_t increment_index_with_wraparound(std::size_t index,
                                                                  std::size_t n = 1)
     {
-        return circular_indexing::increment_index_with_wraparound(FULL_RANGE, index, n).integer;
+        return circular_indexing::increment_index_with_wraparound<MAXIMUM_SIZE>(index, n);
     }
     static constexpr std::size_t decrement_index_with_wraparound(std::size_t index,
                                                                  std::size_t n = 1)
     {
-        return circular_indexing::decrement_index_with_wraparound(FULL_RANGE, index, n).integer;
+        return circular_indexing::decrement_index_with_wraparound<MAXIMUM_SIZE>(index, n);
+    }
+    // `start` and iterator positions count from `FIXED_DEQUE_STARTING_OFFSET`, unwrapped
+    static constexpr std::size_t array_index_of(const std::size_t unwrapped_index)
+    {
+        constexpr std::size_t STARTING_OFFSET_ARRAY_INDEX =
+            circular_indexing::wrap_index<MAXIMUM_SIZE>(FIXED_DEQUE_STARTING_OFFSET);
+        return decrement_index_with_wraparound(
+            circular_indexing::wrap_index<MAXIMUM_SIZE>(unwrapped_index),
+            STARTING_OFFSET_ARRAY_INDEX);
     }
 
 public:
@@ -80,6 +91,8 @@ private:
         ConstOrMutableArray* array_;
         const StartingIntegerAndDistance* starting_index_and_distance_;
         std::size_t current_index_;
+        // Kept in sync with `current_index_`, so dereferencing does not need to wrap
+        std::size_t array_index_;
 
     public:
         constexpr ReferenceProvider() noexcept
@@ -94,6 +107,7 @@ private:
           : array_{array}
           , starting_index_and_distance_{starting_index_and_distance}
           , current_index_{current_index}
+          , array_index_{array_index_of(current_index)}
         {
         }
 
@@ -101,22 +115,29 @@ private:
         template <bool IS_CONST_2>
         constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& mutable_other) noexcept
             requires(IS_CONST and !IS_CONST_2)
-          : ReferenceProvider{mutable_other.array_,
-                              mutable_other.starting_index_and_distance_,
-                              mutable_other.current_index_}
+          : array_{mutable_other.array_}
+          , starting_index_and_distance_{mutable_other.starting_index_and_distance_}
+          , current_index_{mutable_other.current_index_}
+          , array_index_{mutable_other.array_index_}
         {
         }
 
-        constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
-        constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+        constexpr void advance(const std::size_t n) noexcept
+        {
+            current_index_ += n;
+            array_index_ = increment_index_with_wraparound(array_index_, n);
+        }
+        constexpr void recede(const std::size_t n) noexcept
+        {
+            current_index_ -= n;
+            array_index_ = decrement_index_with_wraparound(array_index_, n);
+        }
 
         [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
             const noexcept
         {
             assert_or_abort(starting_index_and_distance_->to_range().contains(current_index_));
-            const std::size_t index =
-                decrement_index_with_wraparound(current_index_, FIXED_DEQUE_STARTING_OFFSET);
-            return optional_storage_detail::get(array_->at(index));
+            return optional_storage_detail::get(array_->at(array_index_));
         }
 
         template <bool IS_CONST2>
@@ -181,6 +202,16 @@ public:
             .start = FIXED_DEQUE_STARTING_OFFSET, .distance = 0}
     // Don't initialize the array
     {
+        // A constexpr context requires everything to be initialized.
+        // The OptionalStorage wrapper takes care of that, but for unwrapped objects
+        // while also being in a constexpr context, initialize array.
+        if constexpr (!std::same_as<OptionalT, optional_storage_detail::OptionalStorage<T>>)
+        {
+            if (std::is_constant_evaluated())
+            {
+                memory::construct_at_address_of(array());
+            }
+        }
     }
 
     constexpr FixedDequeBase(std::size_t count,
@@ -263,6 +294,43 @@ public:
         this->push_back_internal(std::move(value));
     }
 
+    /**
+     * Appends the elements of [first, last) at the back.
+     * The elements are copied one contiguous segment of the storage at a time, which is a single
+     * `memcpy` per segment for a contiguous source of trivially copyable elements.
+     */
+    template <InputIterator InputIt>
+    constexpr void push_back_range(
+        InputIt first,
+        InputIt last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            check_target_size(size() + count, loc);
+            if (count == 0)
+            {
+                return;
+            }
+
+            const std::size_t write_index = end_index();
+            const std::size_t first_segment_size = (std::min)(count, MAXIMUM_SIZE - write_index);
+            const InputIt middle =
+                std::next(first, static_cast<std::ptrdiff_t>(first_segment_size));
+            algorithm::uninitialized_copy(first, middle, segment_start(write_index));
+            algorithm::uninitialized_copy(middle, last, segment_start(0));
+            increment_size(count);
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first, loc);
+            }
+        }
+    }
+
     template <class... Args>
     constexpr reference emplace_back(Args&&... args)
     {
@@ -318,13 +386,30 @@ public:
         decrement_size();
     }
 
+    /**
+     * Removes the first `n` elements. Trivially destructible elements are discarded without being
+     * visited.
+     */
+    constexpr void pop_front_n(
+        const size_type n,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(n <= size()))
+        {
+            Checking::out_of_range(n, size(), loc);
+        }
+        destroy_front_n(n);
+        increment_start(n);
+        decrement_size(n);
+    }
+
     constexpr iterator insert(
         const_iterator pos,
         const value_type& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         check_not_full(loc);
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, value);
         return entry_it;
     }
@@ -334,7 +419,7 @@ public:
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         check_not_full(loc);
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, std::move(value));
         return entry_it;
     }
@@ -361,7 +446,7 @@ public:
     constexpr iterator emplace(const_iterator pos, Args&&... args)
     {
         check_not_full(std_transition::source_location::current());
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, std::forward<Args>(args)...);
         return entry_it;
     }
@@ -408,12 +493,14 @@ public:
             Checking::invalid_argument("iterators exceed container range", loc);
         }
 
-        const auto entry_count_to_move = std::distance(last, cend());
-        const auto entry_count_to_remove = std::distance(first, last);
+        // Close the gap by moving the elements on whichever side of it has fewer
+        const auto entry_count_before = static_cast<std::size_t>(std::distance(cbegin(), first));
+        const auto entry_count_to_remove = static_cast<std::size_t>(std::distance(first, last));
+        const std::size_t entry_count_after = size() - entry_count_before - entry_count_to_remove;
+        const bool move_front_side = entry_count_before < entry_count_after;
 
-        const iterator read_start_it = const_to_mutable_it(last);
-        const iterator read_end_it = std::next(read_start_it, entry_count_to_move);
-        iterator write_start_it = const_to_mutable_it(first);
+        const iterator gap_start_it = const_to_mutable_it(first);
+        const iterator gap_end_it = const_to_mutable_it(last);
 
         if (!std::is_constant_evaluated())
         {
@@ -421,22 +508,49 @@ public:
             // complains about objects being accessed outside their lifetimes.
 
             // Clean out the gap
-            destroy_range(write_start_it, std::next(write_start_it, entry_count_to_remove));
+            destroy_range(gap_start_it, gap_end_it);
 
             // Do the relocation
-            algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            const std::size_t gap_start =
+                increment_index_with_wraparound(front_index(), entry_count_before);
+            const std::size_t gap_end =
+                increment_index_with_wraparound(gap_start, entry_count_to_remove);
+            if (move_front_side)
+            {
+                relocate_toward_back(
+                    front_index(),
+                    increment_index_with_wraparound(front_index(), entry_count_to_remove),
+                    entry_count_before);
+            }
+            else
+            {
+                relocate_toward_front(gap_end, gap_start, entry_count_after);
+            }
+        }
+        else if (move_front_side)
+        {
+            // Do the move
+            std::move_backward(begin(), gap_start_it, gap_end_it);
+
+            // Clean out the head
+            destroy_range(begin(),
+                          std::next(begin(), static_cast<std::ptrdiff_t>(entry_count_to_remove)));
         }
         else
         {
             // Do the move
-            const iterator write_end_it = std::move(read_start_it, read_end_it, write_start_it);
+            const iterator write_end_it = std::move(gap_end_it, end(), gap_start_it);
 
             // Clean out the tail
-            destroy_range(write_end_it, read_end_it);
+            destroy_range(write_end_it, end());
         }
 
-        decrement_size(static_cast<std::size_t>(entry_count_to_remove));
-        return write_start_it;
+        if (move_front_side)
+        {
+            increment_start(entry_count_to_remove);
+        }
+        decrement_size(entry_count_to_remove);
+        return std::next(begin(), static_cast<std::ptrdiff_t>(entry_count_before));
     }
     constexpr iterator erase(const_iterator pos,
                              const std_transition::source_location& loc =
@@ -579,20 +693,47 @@ public:
         return unchecked_at(back_index());
     }
 
-private:
-    constexpr iterator advance_all_after_iterator_by_n(const const_iterator pos,
-                                                       const std::size_t n)
+    /**
+     * The elements as (at most) two contiguous segments of the storage, in order: the first one
+     * starts at the front, the second one holds the elements that wrapped around to the beginning
+     * of the storage and is empty if there are none. Useful for bulk transfers, e.g. `writev()`.
+     */
+    constexpr std::array<std::span<T>, 2> as_spans() noexcept
     {
-        const std::ptrdiff_t value_count_to_move = std::distance(pos, cend());
-        increment_size(n);  // Increment now so iterators are all within valid range
-
-        auto read_start_it = const_to_mutable_it(pos);
-        auto read_end_it = std::next(read_start_it, value_count_to_move);
-        auto write_end_it =
-            std::next(read_start_it, static_cast<std::ptrdiff_t>(n) + value_count_to_move);
-        algorithm::uninitialized_relocate_backward(read_start_it, read_end_it, write_end_it);
+        const std::size_t first_segment_size = this->first_segment_size();
+        return {std::span<T>{segment_start(front_index()), first_segment_size},
+                std::span<T>{segment_start(0), size() - first_segment_size}};
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        const std::size_t first_segment_size = this->first_segment_size();
+        return {std::span<const T>{segment_start(front_index()), first_segment_size},
+                std::span<const T>{segment_start(0), size() - first_segment_size}};
+    }
 
-        return read_start_it;
+private:
+    // Makes room for `n` elements at `pos`, moving the elements on whichever side of it has fewer.
+    // Returns an iterator to the first (uninitialized) entry of the gap.
+    constexpr iterator open_gap_at(const const_iterator pos, const std::size_t n)
+    {
+        const auto count_before = static_cast<std::size_t>(std::distance(cbegin(), pos));
+        const std::size_t count_after = size() - count_before;
+        const std::size_t source = front_index();
+        if (count_before < count_after)
+        {
+            decrement_start(n);
+            relocate_toward_front(source, front_index(), count_before);
+        }
+        else
+        {
+            const std::size_t source_of_after =
+                increment_index_with_wraparound(source, count_before);
+            relocate_toward_back(source_of_after,
+                                 increment_index_with_wraparound(source_of_after, n),
+                                 count_after);
+        }
+        increment_size(n);
+        return std::next(begin(), static_cast<std::ptrdiff_t>(count_before));
     }
 
     template <InputIterator InputIt>
@@ -605,7 +746,7 @@ private:
         const auto entry_count_to_add = static_cast<std::size_t>(std::distance(first, last));
         check_target_size(size() + entry_count_to_add, loc);
 
-        auto write_it = advance_all_after_iterator_by_n(pos, entry_count_to_add);
+        auto write_it = open_gap_at(pos, entry_count_to_add);
         for (auto w_it = write_it; first != last; std::advance(first, 1), std::advance(w_it, 1))
         {
             memory::construct_at_address_of(*w_it, *first);
@@ -694,8 +835,7 @@ private:
 
     [[nodiscard]] constexpr std::size_t front_index() const
     {
-        return decrement_index_with_wraparound(starting_index_and_size().start,
-                                               FIXED_DEQUE_STARTING_OFFSET);
+        return array_index_of(starting_index_and_size().start);
     }
     [[nodiscard]] constexpr std::size_t back_index() const
     {
@@ -748,6 +888,33 @@ private:
         return optional_storage_detail::get(array()[index]);
     }
 
+    [[nodiscard]] constexpr std::size_t first_segment_size() const
+    {
+        return (std::min)(size(), MAXIMUM_SIZE - front_index());
+    }
+    [[nodiscard]] constexpr const T* segment_start(const std::size_t index) const
+    {
+        if constexpr (MAXIMUM_SIZE == 0)
+        {
+            return nullptr;
+        }
+        else
+        {
+            return std::addressof(unchecked_at(index));
+        }
+    }
+    constexpr T* segment_start(const std::size_t index)
+    {
+        if constexpr (MAXIMUM_SIZE == 0)
+        {
+            return nullptr;
+        }
+        else
+        {
+            return std::addressof(unchecked_at(index));
+        }
+    }
+
     constexpr void destroy_at(std::size_t /*index*/)
         requires TriviallyDestructible<T>
     {
@@ -771,6 +938,104 @@ private:
         }
     }
 
+    constexpr void destroy_front_n(std::size_t /*n*/)
+        requires TriviallyDestructible<T>
+    {
+    }
+    // Walks the (at most) two segments with pointers, instead of wrapping an index per element
+    constexpr void destroy_front_n(const std::size_t n)
+        requires NotTriviallyDestructible<T>
+    {
+        const std::size_t first_segment_count = (std::min)(n, first_segment_size());
+        T* const first_segment = segment_start(front_index());
+        for (std::size_t i = 0; i < first_segment_count; i++)
+        {
+            memory::destroy_at_address_of(
+                *std::next(first_segment, static_cast<std::ptrdiff_t>(i)));
+        }
+        T* const second_segment = segment_start(0);
+        for (std::size_t i = 0; i < n - first_segment_count; i++)
+        {
+            memory::destroy_at_address_of(
+                *std::next(second_segment, static_cast<std::ptrdiff_t>(i)));
+        }
+    }
+
+    // Relocates `count` elements from array index `source` to array index `destination`, which
+    // comes before it in the (wrapped) order of the deque. Works one contiguous run at a time, so
+    // that trivially relocatable elements take one `memmove` per run instead of one per element.
+    constexpr void relocate_toward_front(std::size_t source,
+                                         std::size_t destination,
+                                         std::size_t count)
+    {
+        while (count > 0)
+        {
+            const std::size_t run_size =
+                (std::min)({count, MAXIMUM_SIZE - source, MAXIMUM_SIZE - destination});
+            relocate_run(source, destination, run_size);
+            source = increment_index_with_wraparound(source, run_size);
+            destination = increment_index_with_wraparound(destination, run_size);
+            count -= run_size;
+        }
+    }
+    // As above, with `destination` after `source`, so the runs are relocated from the back
+    constexpr void relocate_toward_back(const std::size_t source,
+                                        const std::size_t destination,
+                                        std::size_t count)
+    {
+        // Exclusive ends, where MAXIMUM_SIZE stands for the end of the array
+        std::size_t source_end = increment_index_with_wraparound(source, count);
+        std::size_t destination_end = increment_index_with_wraparound(destination, count);
+        while (count > 0)
+        {
+            source_end = source_end == 0 ? MAXIMUM_SIZE : source_end;
+            destination_end = destination_end == 0 ? MAXIMUM_SIZE : destination_end;
+            const std::size_t run_size = (std::min)({count, source_end, destination_end});
+            source_end -= run_size;
+            destination_end -= run_size;
+            relocate_run(source_end, destination_end, run_size);
+            count -= run_size;
+        }
+    }
+    // Relocates `count` elements between two contiguous runs of the array, which may overlap
+    constexpr void relocate_run(const std::size_t source,
+                                const std::size_t destination,
+                                const std::size_t count)
+    {
+        if (source == destination)
+        {
+            return;
+        }
+        if (std::is_constant_evaluated())
+        {
+            // Element by element, since only simple types are laid out as an array of T
+            const bool toward_front = destination < source;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const std::size_t offset = toward_front ? i : count - 1 - i;
+                memory::construct_at_address_of(unchecked_at(destination + offset),
+                                                std::move(unchecked_at(source + offset)));
+                memory::destroy_at_address_of(unchecked_at(source + offset));
+            }
+            return;
+        }
+
+        T* const source_start = segment_start(source);
+        T* const source_end = std::next(source_start, static_cast<std::ptrdiff_t>(count));
+        T* const destination_start = segment_start(destination);
+        if (destination < source)
+        {
+            algorithm::uninitialized_relocate(source_start, source_end, destination_start);
+        }
+        else
+        {
+            algorithm::uninitialized_relocate_backward(
+                source_start,
+                source_end,
+                std::next(destination_start, static_cast<std::ptrdiff_t>(count)));
+        }
+    }
+
     constexpr void place_at(const std::size_t index, const value_type& value)
     {
         memory::construct_at_address_of(unchecked_at(index), value);
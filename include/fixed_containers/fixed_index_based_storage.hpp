@@ -7,6 +7,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <type_traits>
@@ -110,6 +111,65 @@ public:
         this->set_next_index(other.next_index());
     }
 
+    // Copies the values of `other` into the same indices, along with its freelist, so indices held
+    // by the owner remain valid. The freelist and the array layout are copied with a single memcpy
+    // (see `set_freelist_state_from_other()`) and the values are then copy-constructed in one
+    // sequential pass over the occupied slots.
+    // Warning: Assumes `this` does not currently contain any values!
+    constexpr void copy_from(const FixedIndexBasedPoolStorage& other)
+    {
+        set_freelist_state_from_other(other);
+        other.for_each_occupied_index([&](const std::size_t index)
+                                      { emplace_at(index, other.at(index)); });
+    }
+    constexpr void move_from(FixedIndexBasedPoolStorage& other)
+    {
+        set_freelist_state_from_other(other);
+        other.for_each_occupied_index([&](const std::size_t index)
+                                      { emplace_at(index, std::move(other.at(index))); });
+    }
+
+    // Compaction support. Only the owner knows which indices hold a value, so it drives the
+    // process with `size` being the number of values:
+    //  1) `begin_compaction(size)` keeps only the free slots below `size` in the freelist.
+    //  2) `relocate_for_compaction(index)` moves each value at or above `size` into one of them.
+    //  3) `end_compaction(size)` rebuilds the freelist as [size, MAXIMUM_SIZE), in order.
+    // Afterwards, values occupy [0, size) and new values are emplaced right after them.
+    constexpr void begin_compaction(const std::size_t size) noexcept
+    {
+        std::size_t holes_head = MAXIMUM_SIZE;
+        std::size_t cur_empty = next_index();
+        while (cur_empty != MAXIMUM_SIZE)
+        {
+            const std::size_t next_empty = array_unchecked_at(cur_empty).index;
+            if (cur_empty < size)
+            {
+                array_unchecked_at(cur_empty).index = holes_head;
+                holes_head = cur_empty;
+            }
+            cur_empty = next_empty;
+        }
+        set_next_index(holes_head);
+    }
+    constexpr std::size_t relocate_for_compaction(const std::size_t index) noexcept
+    {
+        const std::size_t new_index = next_index();
+        assert_or_abort(new_index < index);
+        set_next_index(array_unchecked_at(new_index).index);
+        emplace_at(new_index, std::move(at(index)));
+        destroy_at(index);
+        return new_index;
+    }
+    constexpr void end_compaction(const std::size_t size) noexcept
+    {
+        assert_or_abort(next_index() == MAXIMUM_SIZE);
+        for (std::size_t i = size; i < MAXIMUM_SIZE; i++)
+        {
+            array_unchecked_at(i).index = i + 1;
+        }
+        set_next_index(size);
+    }
+
 private:
     [[nodiscard]] constexpr const IndexOrValueT& array_unchecked_at(const std::size_t index) const
     {
@@ -128,6 +188,26 @@ private:
         IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = n;
     }
 
+    // Occupied slots are the ones not in the freelist. Mark the free ones in a bitmap, then visit
+    // the rest in index order.
+    template <class Function>
+    constexpr void for_each_occupied_index(const Function& function) const
+    {
+        constexpr std::size_t WORD_BITS = 64;
+        std::array<std::uint64_t, (MAXIMUM_SIZE + WORD_BITS - 1) / WORD_BITS> is_free{};
+        for (std::size_t i = next_index(); i != MAXIMUM_SIZE; i = array_unchecked_at(i).index)
+        {
+            is_free[i / WORD_BITS] |= std::uint64_t{1} << (i % WORD_BITS);
+        }
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            if ((is_free[i / WORD_BITS] & (std::uint64_t{1} << (i % WORD_BITS))) == 0)
+            {
+                function(i);
+            }
+        }
+    }
+
     template <class... Args>
     constexpr void emplace_at(const std::size_t& index, Args&&... args)
     {
@@ -185,6 +265,16 @@ public:
         return nodes().size();
     }
 
+    // Values keep their indices. Warning: Assumes `this` does not currently contain any values!
+    constexpr void copy_from(const FixedIndexBasedContiguousStorage& other)
+    {
+        nodes() = other.nodes();
+    }
+    constexpr void move_from(FixedIndexBasedContiguousStorage& other)
+    {
+        nodes() = std::move(other.nodes());
+    }
+
 private:
     [[nodiscard]] constexpr const FixedVector<T, MAXIMUM_SIZE>& nodes() const
     {
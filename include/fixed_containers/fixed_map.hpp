@@ -37,7 +37,9 @@ template <class K,
                     ,
                     std::size_t>
           typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION =
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::NONE>
 class FixedMap
 {
 public:
@@ -54,7 +56,9 @@ private:
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        AUGMENTATION == fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE;
 
     template <bool IS_CONST>
     class PairProvider
@@ -613,6 +617,110 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    // Order-statistic operations, O(log n).
+    // Require `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`.
+    [[nodiscard]] constexpr iterator nth(const size_type n) noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        return create_iterator(tree().index_of_nth_at(n));
+    }
+    [[nodiscard]] constexpr const_iterator nth(const size_type n) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        return create_const_iterator(tree().index_of_nth_at(n));
+    }
+    [[nodiscard]] constexpr size_type index_of(const_iterator pos) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        const NodeIndex index = pos == cend() ? NULL_INDEX : get_node_index_from_iterator(pos);
+        return tree().rank_at(index);
+    }
+    // Number of entries with a key less than `key`
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        return tree().rank_at(tree().index_of_node_ceiling(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires HAS_SUBTREE_SIZE && IsTransparent<Compare>
+    {
+        const NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent(key);
+        return tree().rank_at(tree().index_of_node_ceiling(np_idxs));
+    }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept { return tree().key_comp(); }
+
+    // Bulk operations. These walk the in-order traversals of both maps side by side and rebuild
+    // the result as a balanced tree, so they are O(size() + other.size()) instead of the
+    // O(n log n) of inserting one entry at a time.
+    //
+    // Entries of `other` whose key is not in this map are moved into it, the rest stay in `other`.
+    // Unlike std::map::merge(), this relocates the entries and rebuilds both maps in place, so it
+    // invalidates iterators and references into both maps. No temporary map is needed.
+    constexpr void merge(FixedMap& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        const std::size_t merged_size = size() + tree().count_keys_only_in(other.tree());
+        if (preconditions::test(merged_size <= MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(merged_size, loc);
+        }
+
+        tree().merge_in_place(other.tree());
+    }
+    constexpr void merge(FixedMap&& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(other, loc);
+    }
+
+    // Removes the entries with keys that are not less than `key` and returns them. Invalidates
+    // iterators. The returned map is built on the stack, so this uses sizeof(FixedMap) of it.
+    [[nodiscard]] constexpr FixedMap split(const K& key) noexcept
+    {
+        FixedMap upper{key_comp()};
+        tree().split_into(key, upper.tree());
+        return upper;
+    }
+
+    // Moves the entries to the front of the storage, in order, so that iteration walks memory
+    // sequentially again after insertions and erasures have scattered them. Invalidates iterators.
+    constexpr void compact() noexcept { tree().compact(); }
+
+    // Entries with keys found in both maps are copied from `left`.
+    [[nodiscard]] friend constexpr FixedMap set_union(
+        const FixedMap& left,
+        const FixedMap& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::UNION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedMap set_intersection(
+        const FixedMap& left,
+        const FixedMap& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::INTERSECTION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedMap set_difference(
+        const FixedMap& left,
+        const FixedMap& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::DIFFERENCE, loc);
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -621,14 +729,16 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::MapChecking<K> CheckingType2>
+              customize::MapChecking<K> CheckingType2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION_2>
     [[nodiscard]] constexpr bool operator==(const FixedMap<K,
                                                            V,
                                                            MAXIMUM_SIZE_2,
                                                            Compare2,
                                                            COMPACTNESS_2,
                                                            StorageTemplate2,
-                                                           CheckingType2>& other) const
+                                                           CheckingType2,
+                                                           AUGMENTATION_2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -697,10 +807,33 @@ private:
         return {create_const_iterator(l_idx), create_const_iterator(r_idx)};
     }
 
-    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos)
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos) const
     {
         return pos.template private_reference_provider<PairProvider<true>>().current_index();
     }
+
+    using SetOperation = fixed_red_black_tree_detail::SetOperation;
+    [[nodiscard]] static constexpr FixedMap apply_set_operation(
+        const FixedMap& left,
+        const FixedMap& right,
+        const SetOperation& operation,
+        const std_transition::source_location& loc)
+    {
+        // Only a union can outgrow both inputs
+        if (operation == SetOperation::UNION)
+        {
+            const std::size_t union_size =
+                left.size() + left.tree().count_keys_only_in(right.tree());
+            if (preconditions::test(union_size <= MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(union_size, loc);
+            }
+        }
+
+        FixedMap out{left.key_comp()};
+        left.tree().set_operation_into(right.tree(), operation, out.tree());
+        return out;
+    }
 };
 
 template <class K,
@@ -713,10 +846,16 @@ here. clang accepts it */
                     ,
                     std::size_t>
           typename StorageTemplate,
-          customize::MapChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-        container)
+          customize::MapChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+[[nodiscard]] constexpr bool is_full(const FixedMap<K,
+                                                    V,
+                                                    MAXIMUM_SIZE,
+                                                    Compare,
+                                                    COMPACTNESS,
+                                                    StorageTemplate,
+                                                    CheckingType,
+                                                    AUGMENTATION>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -732,13 +871,25 @@ here. clang accepts it */
                     std::size_t>
           typename StorageTemplate,
           customize::MapChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION,
           class Predicate>
-constexpr
-    typename FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-        size_type
-        erase_if(FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-                     container,
-                 Predicate predicate)
+constexpr typename FixedMap<K,
+                            V,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            AUGMENTATION>::size_type
+erase_if(FixedMap<K,
+                  V,
+                  MAXIMUM_SIZE,
+                  Compare,
+                  COMPACTNESS,
+                  StorageTemplate,
+                  CheckingType,
+                  AUGMENTATION>& container,
+         Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -842,10 +993,16 @@ here. clang accepts it */
               ,
               std::size_t>
     typename StorageTemplate,
-    fixed_containers::customize::MapChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::MapChecking<K> CheckingType,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+struct tuple_size<fixed_containers::FixedMap<K,
+                                             V,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             AUGMENTATION>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
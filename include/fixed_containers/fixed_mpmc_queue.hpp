@@ -0,0 +1,268 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/circular_indexing.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace fixed_containers::fixed_mpmc_queue_detail
+{
+// An element together with its sequence number, which tells the threads whose turn it is:
+//  - `2 * position`: free, for the push of `position`
+//  - `2 * position + 1`: holds the element pushed at `position`, for the pop of `position`
+//  - `2 * (position + MAXIMUM_SIZE)`: free again, for the push of `position + MAXIMUM_SIZE`
+// Doubling keeps a full slot apart from a free one for the next round even when
+// `MAXIMUM_SIZE == 1`, where `position + 1` would be both.
+// `SLOT_ALIGNMENT` is raised to the natural alignment of the members if it is weaker.
+template <typename T, std::size_t SLOT_ALIGNMENT>
+struct alignas((std::max)({SLOT_ALIGNMENT, alignof(std::atomic<std::size_t>), alignof(T)})) Slot
+{
+    std::atomic<std::size_t> sequence;
+    optional_storage_detail::OptionalStorage<T> value;
+};
+}  // namespace fixed_containers::fixed_mpmc_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity, lock-free, multi-producer multi-consumer queue, after Dmitry Vyukov's bounded
+ * MPMC queue. Properties:
+ *  - any number of threads may push and pop concurrently
+ *  - `try_*` operations fail instead of blocking when full or empty; `push()`/`pop()` block with
+ *    `std::atomic::wait()` instead
+ *  - no pointers stored and no dynamic allocations
+ *
+ * A push or a pop claims a position with a compare-and-swap on a shared counter, and then waits
+ * only for the sequence number of that position's slot, so producers and consumers do not contend
+ * with each other unless the queue is nearly full or nearly empty.
+ *
+ * `SLOT_ALIGNMENT` is the alignment of each slot. The default puts every slot on its own cache
+ * line, so that threads working on neighbouring slots do not invalidate each other's caches; 1
+ * packs them densely instead, which uses less memory for small elements.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t SLOT_ALIGNMENT = CACHE_LINE_SIZE>
+class FixedMpmcQueue
+{
+    static_assert(MAXIMUM_SIZE > 0, "The queue must be able to hold at least one element");
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "The queue relies on lock-free atomics");
+
+    using Slot = fixed_mpmc_queue_detail::Slot<T, SLOT_ALIGNMENT>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    // Both count every push and pop without wrapping around, see `slot()`
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> push_position_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> pop_position_;
+    alignas(CACHE_LINE_SIZE) std::array<Slot, MAXIMUM_SIZE> slots_;
+
+public:
+    FixedMpmcQueue() noexcept
+      : push_position_{0}
+      , pop_position_{0}
+      , slots_{}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            slots_[i].sequence.store(push_turn(i), std::memory_order_relaxed);
+        }
+    }
+
+    FixedMpmcQueue(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue(FixedMpmcQueue&&) = delete;
+    FixedMpmcQueue& operator=(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue& operator=(FixedMpmcQueue&&) = delete;
+
+    ~FixedMpmcQueue() noexcept
+    {
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            const std::size_t push_position = push_position_.load(std::memory_order_acquire);
+            for (std::size_t position = pop_position_.load(std::memory_order_relaxed);
+                 position != push_position;
+                 position++)
+            {
+                memory::destroy_at_address_of(optional_storage_detail::get(slot(position).value));
+            }
+        }
+    }
+
+    /**
+     * Return whether the element was added, which it is not if the queue is full.
+     */
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        return emplace_internal</*BLOCKING=*/false>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Wait until there is room, then add the element.
+     */
+    void push(const value_type& value) { emplace(value); }
+    void push(value_type&& value) { emplace(std::move(value)); }
+
+    template <class... Args>
+    void emplace(Args&&... args)
+    {
+        emplace_internal</*BLOCKING=*/true>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Remove the front element and return it, or return `std::nullopt` if the queue is empty.
+     */
+    std::optional<value_type> try_pop() { return pop_internal</*BLOCKING=*/false>(); }
+
+    /**
+     * Wait until there is an element, then remove it and return it.
+     */
+    value_type pop() { return *pop_internal</*BLOCKING=*/true>(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * A snapshot, which may be stale by the time it is used. Pushes and pops that are in progress
+     * are counted as done.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        // Loading the pop position first ensures it is not past the loaded push position
+        const std::size_t pop_position = pop_position_.load(std::memory_order_acquire);
+        const std::size_t push_position = push_position_.load(std::memory_order_acquire);
+        return push_position - pop_position;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    Slot& slot(const std::size_t position)
+    {
+        return slots_[circular_indexing::wrap_index<MAXIMUM_SIZE>(position)];
+    }
+
+    // The sequence numbers at which the slot of `position` is ready for its push or its pop
+    static constexpr std::size_t push_turn(const std::size_t position) { return 2 * position; }
+    static constexpr std::size_t pop_turn(const std::size_t position) { return (2 * position) + 1; }
+
+    // How far the sequence number of the slot is from the one that makes it our turn.
+    // Negative means the slot is still waiting for the previous round.
+    static std::ptrdiff_t turn_distance(const std::size_t sequence, const std::size_t expected)
+    {
+        return static_cast<std::ptrdiff_t>(sequence - expected);
+    }
+
+    template <bool BLOCKING, class... Args>
+    bool emplace_internal(Args&&... args)
+    {
+        std::size_t position = push_position_.load(std::memory_order_relaxed);
+        Slot* target = nullptr;
+        while (true)
+        {
+            target = std::addressof(slot(position));
+            const std::size_t sequence = target->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t distance = turn_distance(sequence, push_turn(position));
+            if (distance == 0)
+            {
+                // On failure, `position` is updated to the current one
+                if (push_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (distance < 0)
+            {
+                // Full: the pop of `position - MAXIMUM_SIZE` has not completed yet
+                if constexpr (!BLOCKING)
+                {
+                    return false;
+                }
+                else
+                {
+                    target->sequence.wait(sequence, std::memory_order_acquire);
+                    position = push_position_.load(std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // Another producer claimed `position` already
+                position = push_position_.load(std::memory_order_relaxed);
+            }
+        }
+
+        memory::construct_at_address_of(optional_storage_detail::get(target->value),
+                                        std::forward<Args>(args)...);
+        target->sequence.store(pop_turn(position), std::memory_order_release);
+        target->sequence.notify_all();
+        return true;
+    }
+
+    template <bool BLOCKING>
+    std::optional<value_type> pop_internal()
+    {
+        std::size_t position = pop_position_.load(std::memory_order_relaxed);
+        Slot* target = nullptr;
+        while (true)
+        {
+            target = std::addressof(slot(position));
+            const std::size_t sequence = target->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t distance = turn_distance(sequence, pop_turn(position));
+            if (distance == 0)
+            {
+                // On failure, `position` is updated to the current one
+                if (pop_position_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (distance < 0)
+            {
+                // Empty: the push of `position` has not completed yet
+                if constexpr (!BLOCKING)
+                {
+                    return std::nullopt;
+                }
+                else
+                {
+                    target->sequence.wait(sequence, std::memory_order_acquire);
+                    position = pop_position_.load(std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // Another consumer claimed `position` already
+                position = pop_position_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T& entry = optional_storage_detail::get(target->value);
+        std::optional<value_type> out{std::move(entry)};
+        memory::destroy_at_address_of(entry);
+        target->sequence.store(push_turn(position + MAXIMUM_SIZE), std::memory_order_release);
+        target->sequence.notify_all();
+        return out;
+    }
+};
+
+}  // namespace fixed_containers
@@ -0,0 +1,563 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace fixed_containers::fixed_priority_queue_detail
+{
+// Operations on an implicit d-ary heap stored in `entries`, with the top at index 0 and the
+// children of `i` at [ARITY * i + 1, ARITY * i + ARITY]. A wider heap is shallower, and the
+// children of a node are adjacent in memory, so sift-down reads fewer cache lines than a binary
+// heap would at the cost of more comparisons per level.
+//
+// Both sifts carry a hole instead of swapping: `value` is only placed once, at its final index.
+// `place(index, value)` moves a value into the hole, which lets the indexed queue track positions.
+template <std::size_t ARITY>
+struct DaryHeap
+{
+    static_assert(ARITY >= 2, "A heap needs at least 2 children per node");
+
+    static constexpr std::size_t parent_of(const std::size_t index) { return (index - 1) / ARITY; }
+    static constexpr std::size_t first_child_of(const std::size_t index)
+    {
+        return (ARITY * index) + 1;
+    }
+
+    // `is_lower(a, b)` is true if `a` has lower priority than `b`
+    template <class Entries, class Entry, class IsLower, class Place>
+    static constexpr void sift_up(
+        Entries& entries, std::size_t index, Entry value, const IsLower& is_lower, Place place)
+    {
+        while (index > 0)
+        {
+            const std::size_t parent = parent_of(index);
+            if (!is_lower(entries[parent], value))
+            {
+                break;
+            }
+            place(index, std::move(entries[parent]));
+            index = parent;
+        }
+        place(index, std::move(value));
+    }
+
+    template <class Entries, class Entry, class IsLower, class Place>
+    static constexpr void sift_down(Entries& entries,
+                                    std::size_t index,
+                                    Entry value,
+                                    const std::size_t size,
+                                    const IsLower& is_lower,
+                                    Place place)
+    {
+        while (true)
+        {
+            const std::size_t first_child = first_child_of(index);
+            if (first_child >= size)
+            {
+                break;
+            }
+            const std::size_t last_child = std::min(first_child + ARITY, size);
+            std::size_t best_child = first_child;
+            for (std::size_t child = first_child + 1; child < last_child; child++)
+            {
+                if (is_lower(entries[best_child], entries[child]))
+                {
+                    best_child = child;
+                }
+            }
+            if (!is_lower(value, entries[best_child]))
+            {
+                break;
+            }
+            place(index, std::move(entries[best_child]));
+            index = best_child;
+        }
+        place(index, std::move(value));
+    }
+
+    // Bottom-up heap construction, in O(n). Leaves are already heaps, so only the nodes from the
+    // parent of the last element upwards are sifted.
+    template <class Entries, class IsLower, class Place>
+    static constexpr void heapify(Entries& entries, const IsLower& is_lower, Place place)
+    {
+        const std::size_t size = entries.size();
+        if (size < 2)
+        {
+            return;
+        }
+        for (std::size_t i = parent_of(size - 1) + 1; i-- > 0;)
+        {
+            auto value = std::move(entries[i]);
+            sift_down(entries, i, std::move(value), size, is_lower, place);
+        }
+    }
+};
+
+struct PriorityQueueHandle
+{
+    std::size_t index{};
+
+    constexpr bool operator==(const PriorityQueueHandle& other) const = default;
+};
+}  // namespace fixed_containers::fixed_priority_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity priority queue, with the same interface as `std::priority_queue`: `top()` is the
+ * element for which `Compare` orders every other element before it (the largest one, with the
+ * default `std::less`).
+ *
+ * Elements are stored in a `FixedVector` as an implicit heap with `ARITY` children per node
+ * (4 by default, see `DaryHeap`). Constructing from a range builds the heap in O(n).
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedPriorityQueue
+{
+    using Heap = fixed_priority_queue_detail::DaryHeap<ARITY>;
+
+public:
+    using container_type = FixedVector<T, MAXIMUM_SIZE, CheckingType>;
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    container_type IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{};
+
+public:
+    constexpr FixedPriorityQueue() noexcept
+      : FixedPriorityQueue(Compare{})
+    {
+    }
+
+    explicit constexpr FixedPriorityQueue(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedPriorityQueue(InputIt first,
+                                 InputIt last,
+                                 const Compare& comparator = Compare{},
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{first, last, loc}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+        Heap::heapify(data(), is_lower(), place());
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return data().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return data().empty(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return data().front(loc);
+    }
+
+    constexpr void push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(value, loc);
+        sift_up_back();
+    }
+    constexpr void push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(std::move(value), loc);
+        sift_up_back();
+    }
+
+    template <class... Args>
+    constexpr void emplace(Args&&... args)
+    {
+        data().emplace_back(std::forward<Args>(args)...);
+        sift_up_back();
+    }
+
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        T last = std::move(data().back(loc));
+        data().pop_back(loc);
+        if (!empty())
+        {
+            Heap::sift_down(data(), 0, std::move(last), size(), is_lower(), place());
+        }
+    }
+
+    constexpr void clear() noexcept { data().clear(); }
+
+private:
+    [[nodiscard]] constexpr const container_type& data() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    }
+    constexpr container_type& data() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_; }
+
+    [[nodiscard]] constexpr auto is_lower() const
+    {
+        return [this](const T& lhs, const T& rhs)
+        { return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(lhs, rhs); };
+    }
+    constexpr auto place()
+    {
+        return [this](const std::size_t index, T&& value) { data()[index] = std::move(value); };
+    }
+
+    constexpr void sift_up_back()
+    {
+        const std::size_t index = size() - 1;
+        T value = std::move(data()[index]);
+        Heap::sift_up(data(), index, std::move(value), is_lower(), place());
+    }
+};
+
+/**
+ * Priority queue whose elements are addressed by handles, which remain valid until the element is
+ * popped or erased. Through a handle, an element can be updated or erased in O(log n).
+ * Handles are indices into a table of heap positions, so no memory is allocated.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedIndexedPriorityQueue
+{
+    using Heap = fixed_priority_queue_detail::DaryHeap<ARITY>;
+    using Checking = CheckingType;
+
+public:
+    struct Entry
+    {
+        T value;
+        std::size_t handle_index;
+    };
+
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using handle_type = fixed_priority_queue_detail::PriorityQueueHandle;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<Entry, MAXIMUM_SIZE, CheckingType> IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    // For handles in use, the position of their entry in the heap. For the others, the next
+    // unused handle (a freelist).
+    std::array<std::size_t, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{};
+
+public:
+    constexpr FixedIndexedPriorityQueue() noexcept
+      : FixedIndexedPriorityQueue(Compare{})
+    {
+    }
+
+    explicit constexpr FixedIndexedPriorityQueue(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            positions()[i] = i + 1;
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return heap().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return heap().empty(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return heap().front(loc).value;
+    }
+    [[nodiscard]] constexpr handle_type top_handle(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return handle_type{heap().front(loc).handle_index};
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type handle) const
+    {
+        if (handle.index >= MAXIMUM_SIZE)
+        {
+            return false;
+        }
+        const std::size_t position = positions()[handle.index];
+        return position < size() && heap()[position].handle_index == handle.index;
+    }
+
+    [[nodiscard]] constexpr const_reference at(
+        const handle_type handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_contains(handle, loc);
+        return heap()[positions()[handle.index]].value;
+    }
+
+    constexpr handle_type push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, value);
+    }
+    constexpr handle_type push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_impl(loc, std::move(value));
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace(Args&&... args)
+    {
+        return emplace_impl(std_transition::source_location::current(),
+                            std::forward<Args>(args)...);
+    }
+
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        erase_at(0, loc);
+    }
+
+    constexpr void erase(
+        const handle_type handle,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        erase_at(positions()[handle.index], loc);
+    }
+
+    /**
+     * Replaces the value of `handle` with `value`, which must not have a lower priority than the
+     * current one, and moves it towards the top accordingly. With `std::greater` (a min-heap), this
+     * is the classic decrease-key.
+     */
+    constexpr void decrease_key(
+        const handle_type handle,
+        value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        const std::size_t position = positions()[handle.index];
+        if (preconditions::test(!comparator()(value, heap()[position].value)))
+        {
+            Checking::invalid_argument("decrease_key() would lower the priority", loc);
+        }
+        Heap::sift_up(heap(),
+                      position,
+                      Entry{std::move(value), handle.index},
+                      is_lower(),
+                      place());
+    }
+
+    // Replaces the value of `handle` with `value`, moving it in either direction
+    constexpr void update(
+        const handle_type handle,
+        value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        const std::size_t position = positions()[handle.index];
+        Entry entry{std::move(value), handle.index};
+        if (is_lower()(heap()[position], entry))
+        {
+            Heap::sift_up(heap(), position, std::move(entry), is_lower(), place());
+        }
+        else
+        {
+            Heap::sift_down(heap(), position, std::move(entry), size(), is_lower(), place());
+        }
+    }
+
+    constexpr void clear() noexcept
+    {
+        while (!empty())
+        {
+            release_handle(heap().back().handle_index);
+            heap().pop_back();
+        }
+    }
+
+private:
+    [[nodiscard]] constexpr const FixedVector<Entry, MAXIMUM_SIZE, CheckingType>& heap() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    }
+    constexpr FixedVector<Entry, MAXIMUM_SIZE, CheckingType>& heap()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_heap_;
+    }
+    [[nodiscard]] constexpr const std::array<std::size_t, MAXIMUM_SIZE>& positions() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    }
+    constexpr std::array<std::size_t, MAXIMUM_SIZE>& positions()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_positions_;
+    }
+    [[nodiscard]] constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    [[nodiscard]] constexpr auto is_lower() const
+    {
+        return [this](const Entry& lhs, const Entry& rhs)
+        { return comparator()(lhs.value, rhs.value); };
+    }
+    constexpr auto place()
+    {
+        return [this](const std::size_t index, Entry&& entry)
+        {
+            positions()[entry.handle_index] = index;
+            heap()[index] = std::move(entry);
+        };
+    }
+
+    constexpr void check_contains(const handle_type handle,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(handle)))
+        {
+            Checking::invalid_argument("handle is not in the queue", loc);
+        }
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace_impl(const std_transition::source_location& loc, Args&&... args)
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        const std::size_t handle_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_ = positions()[handle_index];
+
+        const std::size_t index = size();
+        heap().push_back(Entry{T(std::forward<Args>(args)...), handle_index}, loc);
+        Entry entry = std::move(heap()[index]);
+        Heap::sift_up(heap(), index, std::move(entry), is_lower(), place());
+        return handle_type{handle_index};
+    }
+
+    constexpr void erase_at(const std::size_t position, const std_transition::source_location& loc)
+    {
+        release_handle(heap().at(position, loc).handle_index);
+        Entry last = std::move(heap().back());
+        heap().pop_back();
+        if (position == size())
+        {
+            return;
+        }
+        // The last entry can belong anywhere below the parent of the hole
+        if (position > 0 && is_lower()(heap()[Heap::parent_of(position)], last))
+        {
+            Heap::sift_up(heap(), position, std::move(last), is_lower(), place());
+        }
+        else
+        {
+            Heap::sift_down(heap(), position, std::move(last), size(), is_lower(), place());
+        }
+    }
+
+    constexpr void release_handle(const std::size_t handle_index)
+    {
+        positions()[handle_index] = IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_free_handle_ = handle_index;
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
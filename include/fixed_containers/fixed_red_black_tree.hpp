@@ -8,8 +8,15 @@
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
 #include <cstddef>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -30,6 +37,27 @@ namespace fixed_containers::fixed_red_black_tree_detail
 //
 // A good resource for visualizing all RedBlackTree operations as well as generating examples is:
 // https://www.cs.usfca.edu/~galles/visualization/RedBlack.html
+
+// Key types for which `std::less` is known to order the same way as `<=>`. `std::less` may not be
+// specialized for these, as they are not program-defined, so the tree can safely compare them
+// with a single `<=>` instead.
+template <class T>
+struct IsStandardOrderedKey : std::is_arithmetic<T>
+{
+};
+template <class CharT, class Allocator>
+struct IsStandardOrderedKey<std::basic_string<CharT, std::char_traits<CharT>, Allocator>>
+  : std::true_type
+{
+};
+template <class CharT>
+struct IsStandardOrderedKey<std::basic_string_view<CharT, std::char_traits<CharT>>>
+  : std::true_type
+{
+};
+template <class T>
+inline constexpr bool IS_STANDARD_ORDERED_KEY = IsStandardOrderedKey<std::remove_cv_t<T>>::value;
+
 template <class K,
           class V,
           std::size_t MAXIMUM_SIZE,
@@ -39,18 +67,42 @@ template <class K,
                              here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
 class FixedRedBlackTreeBase
 {
 protected:  // [WORKAROUND-1]
     using KeyType = K;
     using ValueType = V;
     static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
-    using TreeStorage = FixedRedBlackTreeStorage<K, V, MAXIMUM_SIZE, COMPACTNESS, StorageTemplate>;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        AUGMENTATION == RedBlackTreeNodeAugmentation::SUBTREE_SIZE;
+    using TreeStorage = FixedRedBlackTreeStorage<K,
+                                                 V,
+                                                 MAXIMUM_SIZE,
+                                                 COMPACTNESS,
+                                                 StorageTemplate,
+                                                 AUGMENTATION>;
     using NodeType = typename TreeStorage::NodeType;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
 
+    // With `std::less`, a single `<=>` gives the same answer as the two `Compare` calls. This is
+    // limited to standard key types: for a program-defined key, `std::less<K>` may be specialized
+    // and `<` may disagree with `<=>`. Pointers are excluded too, because `std::less` guarantees a
+    // total order for them but the built-in operators do not.
+    template <class K1, class K2>
+    static constexpr bool HAS_THREE_WAY_COMPARISON =
+        IS_STANDARD_ORDERED_KEY<K> && IS_STANDARD_ORDERED_KEY<K1> && IS_STANDARD_ORDERED_KEY<K2> &&
+        ((std::same_as<Compare, std::less<K>> && std::same_as<K1, K> && std::same_as<K2, K> &&
+          std::three_way_comparable<K>) ||
+         (std::same_as<Compare, std::less<>> && std::three_way_comparable_with<K1, K2>));
+    // Arithmetic keys are cheap enough to compare both ways at every level, so lookups select the
+    // child without branching. See `branchless_index_of_node_with_parent()`.
+    template <class K0>
+    static constexpr bool HAS_BRANCHLESS_LOOKUP =
+        std::is_arithmetic_v<K> && std::is_arithmetic_v<K0> && HAS_THREE_WAY_COMPARISON<K0, K>;
+
 public:
     using size_type = std::size_t;
     using difference_type = std::ptrdiff_t;
@@ -83,6 +135,11 @@ public:
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
     [[nodiscard]] constexpr bool full() const noexcept { return size() == MAXIMUM_SIZE; }
 
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
     constexpr void clear() noexcept
     {
         delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
@@ -153,6 +210,11 @@ public:
             parent.set_right_index(np_idxs.i);
         }
 
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            increment_subtree_sizes_of_ancestors(np_idxs.i);
+        }
+
         fix_after_insertion(np_idxs.i);
     }
 
@@ -219,6 +281,11 @@ public:
     template <class K0>
     [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent(const K0& key) const
     {
+        if constexpr (HAS_BRANCHLESS_LOOKUP<K0>)
+        {
+            return branchless_index_of_node_with_parent(key);
+        }
+
         NodeIndexAndParentIndex np_idxs{
             .i = root_index(), .parent = NULL_INDEX, .is_left_child = true};
         while (np_idxs.i != NULL_INDEX)
@@ -435,7 +502,447 @@ public:
         return predecessor;
     }
 
+    // Order-statistic queries, O(log n). Only available with
+    // `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`.
+    //
+    // Returns the index of the n-th smallest node (0-based), or NULL_INDEX if n >= size().
+    [[nodiscard]] constexpr NodeIndex index_of_nth_at(const std::size_t n) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        std::size_t remaining = n;
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            const std::size_t left_size = subtree_size_of(node.left_index());
+            if (remaining < left_size)
+            {
+                i = node.left_index();
+                continue;
+            }
+            if (remaining > left_size)
+            {
+                remaining -= left_size + 1;
+                i = node.right_index();
+                continue;
+            }
+
+            return i;
+        }
+
+        return NULL_INDEX;
+    }
+    // Returns the number of nodes that precede the node at `index`. NULL_INDEX, which represents
+    // the past-the-end position, has a rank of size().
+    [[nodiscard]] constexpr std::size_t rank_at(const NodeIndex& index) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        if (index == NULL_INDEX)
+        {
+            return size();
+        }
+
+        std::size_t rank = subtree_size_of(tree_storage().left_index(index));
+        NodeIndex child = index;
+        for (NodeIndex parent = tree_storage().parent_index(index); parent != NULL_INDEX;
+             parent = tree_storage().parent_index(parent))
+        {
+            if (child == tree_storage().right_index(parent))
+            {
+                rank += subtree_size_of(tree_storage().left_index(parent)) + 1;
+            }
+            child = parent;
+        }
+
+        return rank;
+    }
+
+    // Linear-time bulk construction from entries that are already sorted, for example the
+    // in-order traversal of other trees. Entries are first chained into a "vine" (a degenerate
+    // tree where every node is the right child of its predecessor), which is then balanced in-place
+    // with the Day-Stout-Warren algorithm. Both steps are O(n), with no recursion and no
+    // additional memory.
+    //
+    // The tree must be empty before appending the first entry, and entries must be appended in
+    // strictly increasing key order. The tree is not usable until `balance_vine()` is called.
+    template <class... Args>
+    constexpr NodeIndex append_to_vine(const NodeIndex& vine_tail, Args&&... args) noexcept
+    {
+        increment_size();
+        const NodeIndex index =
+            tree_storage().emplace_and_return_index(std::forward<Args>(args)...);
+
+        RedBlackTreeNodeView node = tree_storage_at(index);
+        node.set_parent_index(vine_tail);
+        node.set_color(COLOR_BLACK);
+        if (vine_tail == NULL_INDEX)
+        {
+            set_root_index(index);
+        }
+        else
+        {
+            tree_storage_at(vine_tail).set_right_index(index);
+        }
+
+        return index;
+    }
+
+    constexpr void balance_vine() noexcept
+    {
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            std::size_t subtree_size = 0;
+            for (NodeIndex i = index_of_max_at(); i != NULL_INDEX;
+                 i = tree_storage().parent_index(i))
+            {
+                subtree_size++;
+                tree_storage().set_subtree_size(i, subtree_size);
+            }
+        }
+
+        // The largest perfect tree (2^k - 1 nodes) is formed out of black nodes. The leftover
+        // nodes are rotated down first and end up as red leaves one level below it, which keeps
+        // the black height uniform.
+        std::size_t perfect_size = 0;
+        while (perfect_size * 2 + 1 <= size())
+        {
+            perfect_size = perfect_size * 2 + 1;
+        }
+
+        compress_vine(size() - perfect_size, COLOR_RED);
+        while (perfect_size > 1)
+        {
+            perfect_size /= 2;
+            compress_vine(perfect_size, COLOR_BLACK);
+        }
+    }
+
+    // Bulk operations on whole trees, built on the above. They walk the in-order traversals side
+    // by side and append the result to vines, so they are O(n) in total. The callers make sure the
+    // results fit.
+
+    // Compares the key at `i` with the key at `j` of `other`, as positions of two in-order
+    // traversals, where NULL_INDEX is the past-the-end position and compares greater than
+    // everything.
+    [[nodiscard]] constexpr int compare_in_order(const NodeIndex& i,
+                                                 const FixedRedBlackTreeBase& other,
+                                                 const NodeIndex& j) const
+    {
+        if (i == NULL_INDEX)
+        {
+            return j == NULL_INDEX ? 0 : 1;
+        }
+        if (j == NULL_INDEX)
+        {
+            return -1;
+        }
+
+        const K& left_key = node_at(i).key();
+        const K& right_key = other.node_at(j).key();
+        if (key_comp()(left_key, right_key))
+        {
+            return -1;
+        }
+        if (key_comp()(right_key, left_key))
+        {
+            return 1;
+        }
+        return 0;
+    }
+
+    // Number of keys of `other` that are not in this tree
+    [[nodiscard]] constexpr std::size_t count_keys_only_in(const FixedRedBlackTreeBase& other) const
+    {
+        std::size_t count = 0;
+        NodeIndex i = index_of_min_at();
+        NodeIndex j = other.index_of_min_at();
+        while (j != NULL_INDEX)
+        {
+            const int cmp = compare_in_order(i, other, j);
+            if (cmp <= 0)
+            {
+                i = index_of_successor_at(i);
+            }
+            if (cmp >= 0)
+            {
+                count += static_cast<std::size_t>(cmp > 0);
+                j = other.index_of_successor_at(j);
+            }
+        }
+        return count;
+    }
+
+    // Fills the empty `out` with the entries whose keys are in the union, intersection or
+    // difference of the keys of this tree and `other`. Entries with keys found in both are copied
+    // from this tree.
+    constexpr void set_operation_into(const FixedRedBlackTreeBase& other,
+                                      const SetOperation& operation,
+                                      FixedRedBlackTreeBase& out) const
+    {
+        assert_or_abort(out.empty());
+        NodeIndex out_tail = NULL_INDEX;
+        NodeIndex i = index_of_min_at();
+        NodeIndex j = other.index_of_min_at();
+        while (i != NULL_INDEX || j != NULL_INDEX)
+        {
+            const int cmp = compare_in_order(i, other, j);
+            if (cmp < 0)
+            {
+                if (operation != SetOperation::INTERSECTION)
+                {
+                    out_tail = out.append_copy_to_vine(out_tail, *this, i);
+                }
+                i = index_of_successor_at(i);
+            }
+            else if (cmp > 0)
+            {
+                if (operation == SetOperation::UNION)
+                {
+                    out_tail = out.append_copy_to_vine(out_tail, other, j);
+                }
+                j = other.index_of_successor_at(j);
+            }
+            else
+            {
+                if (operation != SetOperation::DIFFERENCE)
+                {
+                    out_tail = out.append_copy_to_vine(out_tail, *this, i);
+                }
+                i = index_of_successor_at(i);
+                j = other.index_of_successor_at(j);
+            }
+        }
+        out.balance_vine();
+    }
+
+    // Moves the entries of `other` whose keys are not in this tree into it, the rest stay in
+    // `other`. Both trees are flattened into vines and rebuilt in place, so no temporary tree is
+    // needed.
+    constexpr void merge_in_place(FixedRedBlackTreeBase& other)
+    {
+        flatten_to_vine();
+        other.flatten_to_vine();
+        NodeIndex i_prev = NULL_INDEX;
+        NodeIndex i = root_index();
+        NodeIndex j = other.root_index();
+        while (j != NULL_INDEX)
+        {
+            const int cmp = compare_in_order(i, other, j);
+            if (cmp > 0)
+            {
+                i_prev = insert_moved_into_vine_after(i_prev, other, j);
+                j = other.erase_from_vine(j);
+                continue;
+            }
+            if (cmp == 0)
+            {
+                j = other.tree_storage().right_index(j);
+            }
+            i_prev = i;
+            i = tree_storage().right_index(i);
+        }
+        balance_vine();
+        other.balance_vine();
+    }
+
+    // Moves the entries with keys not less than `key` to the empty `upper`. This tree is flattened
+    // into a vine and rebuilt in place.
+    constexpr void split_into(const K& key, FixedRedBlackTreeBase& upper)
+    {
+        assert_or_abort(upper.empty());
+        flatten_to_vine();
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX && key_comp()(node_at(i).key(), key))
+        {
+            i = tree_storage().right_index(i);
+        }
+
+        NodeIndex upper_tail = NULL_INDEX;
+        while (i != NULL_INDEX)
+        {
+            upper_tail = upper.append_moved_to_vine(upper_tail, *this, i);
+            i = erase_from_vine(i);
+        }
+        balance_vine();
+        upper.balance_vine();
+    }
+
+    // Relocates the nodes so that the n-th smallest one is at index n. Iteration then walks the
+    // storage sequentially, which helps after insertions and deletions have scattered the nodes.
+    // Reuses the index-rewiring of FixedRedBlackTreeOps, so it is O(n), plus O(MAXIMUM_SIZE) for
+    // rebuilding the freelist of pool storage. Invalidates all indices.
+    constexpr void compact() noexcept
+        requires std::is_swappable_v<K> && std::is_swappable_v<V>
+    {
+        const std::size_t count = size();
+
+        // First, fill the holes below `count` with the nodes above it
+        if constexpr (TreeStorage::HAS_COMPACTION_SUPPORT)
+        {
+            tree_storage().begin_compaction(count);
+            for (NodeIndex i = index_of_min_at(); i != NULL_INDEX; i = index_of_successor_at(i))
+            {
+                if (i < count)
+                {
+                    continue;
+                }
+
+                const NodeIndex new_index = tree_storage().relocate_for_compaction(i);
+                Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                    *this, tree_storage_at(new_index), i, new_index);
+                if (root_index() == i)
+                {
+                    set_root_index(new_index);
+                }
+                i = new_index;
+            }
+            tree_storage().end_compaction(count);
+        }
+
+        // Then, permute [0, count) into in-order positions
+        NodeIndex i = index_of_min_at();
+        for (NodeIndex target = 0; target < count; target++)
+        {
+            if (i != target)
+            {
+                Ops::swap_nodes_including_key_and_value(*this, target, i);
+            }
+            i = index_of_successor_at(target);
+        }
+    }
+
+protected:
+    // For copying/moving non-trivially-copyable trees in O(n). Nodes keep the indices they have
+    // in `other`, so only keys and values need to be constructed, and there are no lookups.
+    // Warning: Assumes `this` is empty, and already has `other`'s comparator!
+    constexpr void copy_nodes_from(const FixedRedBlackTreeBase& other)
+    {
+        tree_storage().copy_from(other.tree_storage());
+        set_root_index(other.root_index());
+        set_size(other.size());
+    }
+    constexpr void move_nodes_from(FixedRedBlackTreeBase& other)
+    {
+        tree_storage().move_from(other.tree_storage());
+        set_root_index(other.root_index());
+        set_size(other.size());
+    }
+
 private:
+    constexpr NodeIndex append_copy_to_vine(const NodeIndex& vine_tail,
+                                            const FixedRedBlackTreeBase& source,
+                                            const NodeIndex& index)
+    {
+        const auto node = source.node_at(index);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return append_to_vine(vine_tail, node.key(), node.value());
+        }
+        else
+        {
+            return append_to_vine(vine_tail, node.key());
+        }
+    }
+    constexpr NodeIndex append_moved_to_vine(const NodeIndex& vine_tail,
+                                             FixedRedBlackTreeBase& source,
+                                             const NodeIndex& index)
+    {
+        auto node = source.node_at(index);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return append_to_vine(vine_tail, std::move(node.key()), std::move(node.value()));
+        }
+        else
+        {
+            return append_to_vine(vine_tail, std::move(node.key()));
+        }
+    }
+
+    // The inverse of `balance_vine()`, with right rotations. The vine can then be walked in order
+    // while inserting and erasing entries, which a tree can not. O(n).
+    constexpr void flatten_to_vine()
+    {
+        NodeIndex index = root_index();
+        while (index != NULL_INDEX)
+        {
+            const NodeIndex l_idx = tree_storage().left_index(index);
+            if (l_idx != NULL_INDEX)
+            {
+                rotate_right(index);
+                index = l_idx;
+            }
+            else
+            {
+                tree_storage().set_color(index, COLOR_BLACK);
+                index = tree_storage().right_index(index);
+            }
+        }
+    }
+
+    // Inserts the entry of `source` at `index` into the vine right after `vine_prev`, or at the
+    // front if that is NULL_INDEX. Keys must stay in strictly increasing order.
+    constexpr NodeIndex insert_moved_into_vine_after(const NodeIndex& vine_prev,
+                                                     FixedRedBlackTreeBase& source,
+                                                     const NodeIndex& index)
+    {
+        const NodeIndex next =
+            vine_prev == NULL_INDEX ? root_index() : tree_storage().right_index(vine_prev);
+        const NodeIndex inserted = append_moved_to_vine(vine_prev, source, index);
+        if (next != NULL_INDEX)
+        {
+            tree_storage_at(inserted).set_right_index(next);
+            tree_storage_at(next).set_parent_index(inserted);
+        }
+        return inserted;
+    }
+
+    // Unlinks and deletes the node at `index` of the vine, and returns the index of the next one.
+    // With contiguous storage, another node is moved into the freed index, and its neighbours are
+    // pointed to its new index.
+    constexpr NodeIndex erase_from_vine(const NodeIndex& index)
+    {
+        const NodeIndex parent = tree_storage().parent_index(index);
+        NodeIndex next = tree_storage().right_index(index);
+        if (parent == NULL_INDEX)
+        {
+            set_root_index(next);
+        }
+        else
+        {
+            tree_storage_at(parent).set_right_index(next);
+        }
+        if (next != NULL_INDEX)
+        {
+            tree_storage_at(next).set_parent_index(parent);
+        }
+        decrement_size();
+
+        const NodeIndex repositioned =
+            tree_storage().delete_at_and_return_repositioned_index(index);
+        if (repositioned != index)
+        {
+            Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                *this, tree_storage_at(index), repositioned, index);
+            fixup_repositioned_index(
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, repositioned, index);
+            fixup_repositioned_index(next, repositioned, index);
+        }
+        return next;
+    }
+
+    // A single Day-Stout-Warren pass: rotates every other node of the vine down, `count` times.
+    constexpr void compress_vine(const std::size_t count, const NodeColor& rotated_down_color)
+    {
+        NodeIndex index = root_index();
+        for (std::size_t c = 0; c < count; c++)
+        {
+            const NodeIndex r_idx = tree_storage().right_index(index);
+            rotate_left(index);
+            tree_storage().set_color(index, rotated_down_color);
+            index = tree_storage().right_index(r_idx);
+        }
+    }
+
     constexpr void increment_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
@@ -449,9 +956,51 @@ private:
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
     }
 
+    // Same result as `index_of_node_with_parent()`, but the only branch is the exit on a match.
+    // Both children are prefetched before the comparison resolves, and the next index is picked by
+    // indexing into {left, right}.
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex branchless_index_of_node_with_parent(
+        const K0& key) const
+    {
+        NodeIndexAndParentIndex np_idxs{
+            .i = root_index(), .parent = NULL_INDEX, .is_left_child = true};
+        while (np_idxs.i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView current_node = tree_storage_at(np_idxs.i);
+            const std::array<NodeIndex, 2> children{current_node.left_index(),
+                                                    current_node.right_index()};
+            // A missing child prefetches the current node instead, which is already in cache
+            for (const NodeIndex& child : children)
+            {
+                tree_storage().prefetch(child == NULL_INDEX ? np_idxs.i : child);
+            }
+
+            const K& current_key = current_node.key();
+            const bool is_less = key < current_key;
+            const bool is_greater = current_key < key;
+            if (!is_less && !is_greater)
+            {
+                return np_idxs;
+            }
+
+            np_idxs.parent = np_idxs.i;
+            np_idxs.is_left_child = !is_greater;
+            np_idxs.i = children[static_cast<std::size_t>(is_greater)];
+        }
+
+        return np_idxs;
+    }
+
     template <class K1, class K2>
     [[nodiscard]] constexpr int compare(const K1& left, const K2& right) const
     {
+        if constexpr (HAS_THREE_WAY_COMPARISON<K1, K2>)
+        {
+            const auto cmp = left <=> right;
+            // Unordered values (e.g. NaN) are equivalent, as with two `std::less` calls
+            return static_cast<int>(std::is_gt(cmp)) - static_cast<int>(std::is_lt(cmp));
+        }
         if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(left, right))
         {
             return -1;
@@ -463,6 +1012,39 @@ private:
         return 0;
     }
 
+    [[nodiscard]] constexpr std::size_t subtree_size_of(const NodeIndex& index) const
+        requires HAS_SUBTREE_SIZE
+    {
+        return index == NULL_INDEX ? 0 : tree_storage().subtree_size(index);
+    }
+    constexpr void recompute_subtree_size(const NodeIndex& index)
+        requires HAS_SUBTREE_SIZE
+    {
+        RedBlackTreeNodeView node = tree_storage_at(index);
+        node.set_subtree_size(subtree_size_of(node.left_index()) +
+                              subtree_size_of(node.right_index()) + 1);
+    }
+    constexpr void increment_subtree_sizes_of_ancestors(const NodeIndex& index)
+        requires HAS_SUBTREE_SIZE
+    {
+        for (NodeIndex i = tree_storage().parent_index(index); i != NULL_INDEX;
+             i = tree_storage().parent_index(i))
+        {
+            RedBlackTreeNodeView node = tree_storage_at(i);
+            node.set_subtree_size(node.subtree_size() + 1);
+        }
+    }
+    constexpr void decrement_subtree_sizes_of_ancestors(const NodeIndex& index)
+        requires HAS_SUBTREE_SIZE
+    {
+        for (NodeIndex i = tree_storage().parent_index(index); i != NULL_INDEX;
+             i = tree_storage().parent_index(i))
+        {
+            RedBlackTreeNodeView node = tree_storage_at(i);
+            node.set_subtree_size(node.subtree_size() - 1);
+        }
+    }
+
     [[nodiscard]] constexpr bool has_two_children(const NodeIndex& index) const
     {
         const RedBlackTreeNodeView node = tree_storage_at(index);
@@ -533,6 +1115,13 @@ private:
 
         right.set_left_index(index);
         node.set_parent_index(r_idx);
+
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            // `right` takes over the whole subtree, `node` needs to be recomputed
+            right.set_subtree_size(node.subtree_size());
+            recompute_subtree_size(index);
+        }
     }
 
     constexpr void rotate_right(const NodeIndex& index)
@@ -568,6 +1157,13 @@ private:
 
         left.set_right_index(index);
         node.set_parent_index(l_idx);
+
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            // `left` takes over the whole subtree, `node` needs to be recomputed
+            left.set_subtree_size(node.subtree_size());
+            recompute_subtree_size(index);
+        }
     }
 
     constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
@@ -664,6 +1260,15 @@ private:
             Ops::swap_nodes_excluding_key_and_value(*this, index_to_delete, successor_index);
         }
 
+        // The node to delete now has at most 1 child. Detach it from the subtree sizes before any
+        // rotation happens; it may remain linked as a leaf during `fix_after_deletion()`, so it
+        // must not contribute to the sizes computed there.
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            tree_storage().set_subtree_size(index_to_delete, 0);
+            decrement_subtree_sizes_of_ancestors(index_to_delete);
+        }
+
         // Start fixup at replacement node, if it exists
         const NodeIndex replacement_node_index = [this, &index_to_delete]()
         {
@@ -865,13 +1470,24 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
 class FixedRedBlackTree
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              AUGMENTATION>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    AUGMENTATION>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -894,43 +1510,15 @@ public:
         requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
     = default;
 
-    // TODO: Use O(N) algorithm. Do non-recursive
     constexpr FixedRedBlackTree(const FixedRedBlackTree& other)
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.key_comp())
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->copy_nodes_from(other);
     }
     constexpr FixedRedBlackTree(FixedRedBlackTree&& other) noexcept
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.key_comp())
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->move_nodes_from(other);
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
         other.clear();
@@ -943,20 +1531,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        // The nodes are laid out in the order of `other`'s comparator
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ = other.key_comp();
+        this->copy_nodes_from(other);
         return *this;
     }
     constexpr FixedRedBlackTree& operator=(FixedRedBlackTree&& other) noexcept
@@ -967,21 +1544,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        // The nodes are laid out in the order of `other`'s comparator
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ = other.key_comp();
+        this->move_nodes_from(other);
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
         // Both choices are fine, because the state of a moved object is intentionally unspecified
@@ -1001,13 +1566,24 @@ template <TriviallyCopyable K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
-class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
+class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              AUGMENTATION>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    AUGMENTATION>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -1034,9 +1610,10 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate = FixedIndexBasedPoolStorage>
+          typename StorageTemplate = FixedIndexBasedPoolStorage,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
 using FixedRedBlackTree = fixed_red_black_tree_detail::specializations::
-    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
 
 template <class K,
           std::size_t MAXIMUM_SIZE,
@@ -1044,7 +1621,13 @@ template <class K,
           RedBlackTreeNodeColorCompactness COMPACTNESS =
               RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
           template <IsFixedIndexBasedStorage, std::size_t> typename StorageTemplate =
-              FixedIndexBasedPoolStorage>
-using FixedRedBlackTreeSet =
-    FixedRedBlackTree<K, EmptyValue, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+              FixedIndexBasedPoolStorage,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
+using FixedRedBlackTreeSet = FixedRedBlackTree<K,
+                                               EmptyValue,
+                                               MAXIMUM_SIZE,
+                                               Compare,
+                                               COMPACTNESS,
+                                               StorageTemplate,
+                                               AUGMENTATION>;
 }  // namespace fixed_containers::fixed_red_black_tree_detail
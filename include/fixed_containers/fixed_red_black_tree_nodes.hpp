@@ -46,6 +46,15 @@ concept IsRedBlackTreeNodeWithValue =
         mutable_s.value();
     };
 
+template <class T>
+concept IsRedBlackTreeNodeWithSubtreeSize =
+    IsRedBlackTreeNode<T> && requires(const T& const_s,
+                                      std::remove_const_t<T>& mutable_s,
+                                      const NodeIndex& size) {
+        const_s.subtree_size();
+        mutable_s.set_subtree_size(size);
+    };
+
 template <class K, class V = EmptyValue>
 class DefaultRedBlackTreeNode
 {
@@ -323,6 +332,27 @@ public:
     }
 };
 
+// Augments any of the above nodes with the number of nodes in the subtree rooted at this node
+// (including itself). See `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`.
+template <class BaseNode>
+class SubtreeSizeAugmentedRedBlackTreeNode : public BaseNode
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_ = 1;
+
+public:
+    using BaseNode::BaseNode;
+
+    [[nodiscard]] constexpr NodeIndex subtree_size() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_;
+    }
+    constexpr void set_subtree_size(const NodeIndex& new_subtree_size)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_ = new_subtree_size;
+    }
+};
+
 template <class S>
 class RedBlackTreeNodeView
 {
@@ -333,6 +363,8 @@ public:
     using KeyType = K;
     using ValueType = V;
     static constexpr bool HAS_ASSOCIATED_VALUE = S::HAS_ASSOCIATED_VALUE;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        requires(const S& storage, const NodeIndex& index) { storage.subtree_size(index); };
     static constexpr bool IS_MUTABLE = !std::is_const_v<S>;
 
 private:
@@ -399,6 +431,17 @@ public:
     {
         return storage_->set_color(node_index_, new_color);
     }
+
+    [[nodiscard]] constexpr NodeIndex subtree_size() const
+        requires HAS_SUBTREE_SIZE
+    {
+        return storage_->subtree_size(node_index_);
+    }
+    constexpr void set_subtree_size(const NodeIndex& new_subtree_size)
+        requires IS_MUTABLE && HAS_SUBTREE_SIZE
+    {
+        return storage_->set_subtree_size(node_index_, new_subtree_size);
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
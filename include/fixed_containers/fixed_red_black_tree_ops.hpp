@@ -5,6 +5,7 @@
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
+#include <type_traits>
 #include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
@@ -68,6 +69,16 @@ class FixedRedBlackTreeOps
             [](RedBlackTreeNodeView<TreeStorage> node) { return node.color(); },
             [](RedBlackTreeNodeView<TreeStorage> node, NodeColor color) { node.set_color(color); });
     }
+    static constexpr void swap_subtree_size(RedBlackTreeNodeView<TreeStorage> node_i,
+                                            RedBlackTreeNodeView<TreeStorage> node_j)
+    {
+        swap_via_getter_and_setter(
+            node_i,
+            node_j,
+            [](RedBlackTreeNodeView<TreeStorage> node) { return node.subtree_size(); },
+            [](RedBlackTreeNodeView<TreeStorage> node, NodeIndex size)
+            { node.set_subtree_size(size); });
+    }
 
 public:
     constexpr FixedRedBlackTreeOps() = delete;
@@ -122,14 +133,17 @@ public:
     static constexpr void swap_nodes_including_key_and_value(RedBlackTreeStorage& tree,
                                                              const NodeIndex& index_i,
                                                              const NodeIndex& index_j)
-        requires TriviallyCopyable<K> && TriviallyCopyable<V>
+        requires std::is_swappable_v<K> && std::is_swappable_v<V>
     {
         swap_nodes_excluding_key_and_value(tree, index_i, index_j);
 
         RedBlackTreeNodeView node_i = tree.node_at(index_i);
         RedBlackTreeNodeView node_j = tree.node_at(index_j);
         std::swap(node_i.key(), node_j.key());
-        std::swap(node_i.value(), node_j.value());
+        if constexpr (IsNotEmpty<V>)
+        {
+            std::swap(node_i.value(), node_j.value());
+        }
     }
 
 private:
@@ -208,6 +222,12 @@ private:
         }
 
         swap_color(node_i, node_j);
+
+        // Subtree sizes belong to the position in the tree, not to the key/value
+        if constexpr (TreeStorage::HAS_SUBTREE_SIZE)
+        {
+            swap_subtree_size(node_i, node_j);
+        }
     }
 };
 
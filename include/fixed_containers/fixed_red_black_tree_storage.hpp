@@ -3,6 +3,7 @@
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/memory.hpp"
 
 #include <type_traits>
 #include <utility>
@@ -50,17 +51,25 @@ template <class K,
           std::size_t MAXIMUM_SIZE,
           RedBlackTreeNodeColorCompactness COMPACTNESS,
           template <IsFixedIndexBasedStorage, std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
 class FixedRedBlackTreeStorage
 {
+    using BaseNodeType =
+        std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                           CompactRedBlackTreeNode<K, V>,
+                           DefaultRedBlackTreeNode<K, V>>;
+
 public:
     using KeyType = K;
     using ValueType = V;
     using NodeType =
-        std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
-                           CompactRedBlackTreeNode<K, V>,
-                           DefaultRedBlackTreeNode<K, V>>;
+        std::conditional_t<AUGMENTATION == RedBlackTreeNodeAugmentation::SUBTREE_SIZE,
+                           SubtreeSizeAugmentedRedBlackTreeNode<BaseNodeType>,
+                           BaseNodeType>;
     static constexpr bool HAS_ASSOCIATED_VALUE = NodeType::HAS_ASSOCIATED_VALUE;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        AUGMENTATION == RedBlackTreeNodeAugmentation::SUBTREE_SIZE;
     using size_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::size_type;
     using difference_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::difference_type;
 
@@ -90,6 +99,10 @@ public:
         return storage().at(index).key();
     }
     constexpr K& key(const NodeIndex& index) { return storage().at(index).key(); }
+    constexpr void prefetch(const NodeIndex& index) const
+    {
+        memory::prefetch_address_of(storage().at(index));
+    }
     [[nodiscard]] constexpr const V& value(const NodeIndex& index) const
         requires HAS_ASSOCIATED_VALUE
     {
@@ -137,6 +150,17 @@ public:
         return storage().at(index).set_color(new_color);
     }
 
+    [[nodiscard]] constexpr NodeIndex subtree_size(const NodeIndex& index) const
+        requires HAS_SUBTREE_SIZE
+    {
+        return storage().at(index).subtree_size();
+    }
+    constexpr void set_subtree_size(const NodeIndex& index, const NodeIndex& new_subtree_size)
+        requires HAS_SUBTREE_SIZE
+    {
+        return storage().at(index).set_subtree_size(new_subtree_size);
+    }
+
     template <class... Args>
     constexpr NodeIndex emplace_and_return_index(Args&&... args)
     {
@@ -148,6 +172,39 @@ public:
         return storage().delete_at_and_return_repositioned_index(index);
     }
 
+    // Nodes keep their indices, so their parent/left/right indices are copied verbatim.
+    constexpr void copy_from(const FixedRedBlackTreeStorage& other)
+    {
+        storage().copy_from(other.storage());
+    }
+    constexpr void move_from(FixedRedBlackTreeStorage& other)
+    {
+        storage().move_from(other.storage());
+    }
+
+    // See FixedIndexBasedPoolStorage. Other storages are always compact.
+    static constexpr bool HAS_COMPACTION_SUPPORT =
+        requires(StorageTemplate<NodeType, MAXIMUM_SIZE>& storage, const std::size_t index) {
+            storage.begin_compaction(index);
+            storage.relocate_for_compaction(index);
+            storage.end_compaction(index);
+        };
+    constexpr void begin_compaction(const std::size_t size) noexcept
+        requires HAS_COMPACTION_SUPPORT
+    {
+        storage().begin_compaction(size);
+    }
+    constexpr NodeIndex relocate_for_compaction(const NodeIndex& index) noexcept
+        requires HAS_COMPACTION_SUPPORT
+    {
+        return storage().relocate_for_compaction(index);
+    }
+    constexpr void end_compaction(const std::size_t size) noexcept
+        requires HAS_COMPACTION_SUPPORT
+    {
+        storage().end_compaction(size);
+    }
+
 private:
     [[nodiscard]] constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
@@ -101,10 +101,29 @@ struct SuccessorIndexAndRepositionedIndex
     NodeIndex repositioned;
 };
 
+// Opt-in extra information that is stored in every node and maintained by all the tree
+// operations (insertion, deletion and rotations).
+//
+// SUBTREE_SIZE stores the number of nodes in the subtree rooted at each node, which turns the tree
+// into an order-statistic tree: the n-th element and the rank of a key can be found in O(log n).
+enum class RedBlackTreeNodeAugmentation : bool
+{
+    NONE = false,
+    SUBTREE_SIZE = true,
+};
+
 enum class RedBlackTreeStorageType
 {
     FIXED_INDEX_POOL,
     FIXED_INDEX_CONTIGUOUS,
 };
 
+// See `FixedRedBlackTreeBase::set_operation_into()`
+enum class SetOperation
+{
+    UNION,
+    INTERSECTION,
+    DIFFERENCE,
+};
+
 }  // namespace fixed_containers::fixed_red_black_tree_detail
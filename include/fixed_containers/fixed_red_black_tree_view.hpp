@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 
@@ -268,9 +269,9 @@ public:
             }
 
             case StorageType::FIXED_INDEX_CONTIGUOUS:
-                const auto vector_size_bytes = sizeof(std::size_t);
                 const auto vector_data_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
-                return vector_size_bytes + vector_data_size_bytes;
+                return align_up(contiguous_array_offset_bytes() + vector_data_size_bytes,
+                                sizeof(uintptr_t));
             }
 
             assert_or_abort(false);
@@ -300,8 +301,8 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            const auto* const array_ptr =
-                std::next(fixed_vector_ptr, static_cast<difference_type>(sizeof(std::size_t)));
+            const auto* const array_ptr = std::next(
+                fixed_vector_ptr, static_cast<difference_type>(contiguous_array_offset_bytes()));
             return array_ptr;
         }
 
@@ -315,7 +316,50 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            switch (contiguous_vector_size_field_bytes())
+            {
+            case sizeof(std::uint8_t):
+                return *reinterpret_cast<const std::uint8_t*>(fixed_vector_ptr);
+            case sizeof(std::uint16_t):
+                return *reinterpret_cast<const std::uint16_t*>(fixed_vector_ptr);
+            case sizeof(std::uint32_t):
+                return *reinterpret_cast<const std::uint32_t*>(fixed_vector_ptr);
+            default:
+                return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            }
+        }
+
+        /**
+         * Calculate the size of the fixed vector's size member, which is the smallest unsigned
+         * integral type that fits the maximum size. See `int_math::SmallestUnsignedIntegralFor`.
+         * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
+         */
+        [[nodiscard]] std::size_t contiguous_vector_size_field_bytes() const
+        {
+            assert_or_abort(storage_type_ == StorageType::FIXED_INDEX_CONTIGUOUS);
+            if (max_size_bytes_ <= (std::numeric_limits<std::uint8_t>::max)())
+            {
+                return sizeof(std::uint8_t);
+            }
+            if (max_size_bytes_ <= (std::numeric_limits<std::uint16_t>::max)())
+            {
+                return sizeof(std::uint16_t);
+            }
+            if (max_size_bytes_ <= (std::numeric_limits<std::uint32_t>::max)())
+            {
+                return sizeof(std::uint32_t);
+            }
+            return sizeof(std::size_t);
+        }
+
+        /**
+         * Calculate the offset of the fixed vector's array of tree nodes, which follows the size
+         * member, padded to the alignment of the nodes.
+         * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
+         */
+        [[nodiscard]] std::size_t contiguous_array_offset_bytes() const
+        {
+            return align_up(contiguous_vector_size_field_bytes(), sizeof(uintptr_t));
         }
 
         /**
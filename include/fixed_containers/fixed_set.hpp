@@ -36,7 +36,9 @@ template <class K,
                     ,
                     std::size_t>
           typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION =
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::NONE>
 class FixedSet
 {
 public:
@@ -52,7 +54,9 @@ private:
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        AUGMENTATION == fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE;
 
     class ReferenceProvider
     {
@@ -378,6 +382,105 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    // Order-statistic operations, O(log n).
+    // Require `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`.
+    [[nodiscard]] constexpr const_iterator nth(const size_type n) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        return create_const_iterator(tree().index_of_nth_at(n));
+    }
+    [[nodiscard]] constexpr size_type index_of(const_iterator pos) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        const NodeIndex index = pos == cend() ? NULL_INDEX : get_node_index_from_iterator(pos);
+        return tree().rank_at(index);
+    }
+    // Number of entries less than `key`
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires HAS_SUBTREE_SIZE
+    {
+        return tree().rank_at(tree().index_of_node_ceiling(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires HAS_SUBTREE_SIZE && IsTransparent<Compare>
+    {
+        const NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent(key);
+        return tree().rank_at(tree().index_of_node_ceiling(np_idxs));
+    }
+
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept { return tree().key_comp(); }
+
+    // Bulk operations. These walk the in-order traversals of both sets side by side and rebuild
+    // the result as a balanced tree, so they are O(size() + other.size()) instead of the
+    // O(n log n) of inserting one key at a time.
+    //
+    // Keys of `other` that are not in this set are moved into it, the rest stay in `other`.
+    // Unlike std::set::merge(), this relocates the keys and rebuilds both sets in place, so it
+    // invalidates iterators and references into both sets. No temporary set is needed.
+    constexpr void merge(FixedSet& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        const std::size_t merged_size = size() + tree().count_keys_only_in(other.tree());
+        if (preconditions::test(merged_size <= MAXIMUM_SIZE))
+        {
+            CheckingType::length_error(merged_size, loc);
+        }
+
+        tree().merge_in_place(other.tree());
+    }
+    constexpr void merge(FixedSet&& other,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(other, loc);
+    }
+
+    // Removes the keys that are not less than `key` and returns them. Invalidates
+    // iterators. The returned set is built on the stack, so this uses sizeof(FixedSet) of it.
+    [[nodiscard]] constexpr FixedSet split(const K& key) noexcept
+    {
+        FixedSet upper{key_comp()};
+        tree().split_into(key, upper.tree());
+        return upper;
+    }
+
+    // Moves the entries to the front of the storage, in order, so that iteration walks memory
+    // sequentially again after insertions and erasures have scattered them. Invalidates iterators.
+    constexpr void compact() noexcept { tree().compact(); }
+
+    // Keys found in both sets are copied from `left`.
+    [[nodiscard]] friend constexpr FixedSet set_union(
+        const FixedSet& left,
+        const FixedSet& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::UNION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedSet set_intersection(
+        const FixedSet& left,
+        const FixedSet& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::INTERSECTION, loc);
+    }
+    [[nodiscard]] friend constexpr FixedSet set_difference(
+        const FixedSet& left,
+        const FixedSet& right,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return apply_set_operation(left, right, SetOperation::DIFFERENCE, loc);
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -386,10 +489,16 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::SetChecking<K> CheckingType2>
+              customize::SetChecking<K> CheckingType2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION_2>
     [[nodiscard]] constexpr bool operator==(
-        const FixedSet<K, MAXIMUM_SIZE_2, Compare2, COMPACTNESS_2, StorageTemplate2, CheckingType2>&
-            other) const
+        const FixedSet<K,
+                       MAXIMUM_SIZE_2,
+                       Compare2,
+                       COMPACTNESS_2,
+                       StorageTemplate2,
+                       CheckingType2,
+                       AUGMENTATION_2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -438,10 +547,33 @@ private:
         return {create_const_iterator(l_idx), create_const_iterator(r_idx)};
     }
 
-    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos)
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos) const
     {
         return pos.template private_reference_provider<ReferenceProvider>().current_index();
     }
+
+    using SetOperation = fixed_red_black_tree_detail::SetOperation;
+    [[nodiscard]] static constexpr FixedSet apply_set_operation(
+        const FixedSet& left,
+        const FixedSet& right,
+        const SetOperation& operation,
+        const std_transition::source_location& loc)
+    {
+        // Only a union can outgrow both inputs
+        if (operation == SetOperation::UNION)
+        {
+            const std::size_t union_size =
+                left.size() + left.tree().count_keys_only_in(right.tree());
+            if (preconditions::test(union_size <= MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(union_size, loc);
+            }
+        }
+
+        FixedSet out{left.key_comp()};
+        left.tree().set_operation_into(right.tree(), operation, out.tree());
+        return out;
+    }
 };
 
 template <class K,
@@ -453,9 +585,15 @@ here. clang accepts it */
                     ,
                     std::size_t>
           typename StorageTemplate,
-          customize::SetChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container)
+          customize::SetChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+[[nodiscard]] constexpr bool is_full(const FixedSet<K,
+                                                    MAXIMUM_SIZE,
+                                                    Compare,
+                                                    COMPACTNESS,
+                                                    StorageTemplate,
+                                                    CheckingType,
+                                                    AUGMENTATION>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -470,12 +608,19 @@ here. clang accepts it */
                     std::size_t>
           typename StorageTemplate,
           customize::SetChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION,
           class Predicate>
-constexpr typename FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-    size_type
-    erase_if(
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container,
-        Predicate predicate)
+constexpr typename FixedSet<K,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            AUGMENTATION>::size_type
+erase_if(
+    FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType, AUGMENTATION>&
+        container,
+    Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -572,10 +717,15 @@ here. clang accepts it */
               ,
               std::size_t>
     typename StorageTemplate,
-    fixed_containers::customize::SetChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::SetChecking<K> CheckingType,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+struct tuple_size<fixed_containers::FixedSet<K,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             AUGMENTATION>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
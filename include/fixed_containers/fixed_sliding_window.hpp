@@ -0,0 +1,399 @@
+#pragma once
+
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+namespace fixed_containers::sliding_window_ops
+{
+// The first of the smallest elements according to `Compare`
+template <typename Compare = std::less<>>
+struct Min
+{
+    Compare compare{};
+
+    template <typename T>
+    constexpr const T& operator()(const T& lhs, const T& rhs) const
+    {
+        return compare(rhs, lhs) ? rhs : lhs;
+    }
+    // Whether `newer` is preferred over the older element `older` for as long as both are in the
+    // window, so that `older` can never be the result again
+    template <typename T>
+    constexpr bool supersedes(const T& newer, const T& older) const
+    {
+        return compare(newer, older);
+    }
+};
+
+// The first of the largest elements according to `Compare`
+template <typename Compare = std::less<>>
+struct Max
+{
+    Compare compare{};
+
+    template <typename T>
+    constexpr const T& operator()(const T& lhs, const T& rhs) const
+    {
+        return compare(lhs, rhs) ? rhs : lhs;
+    }
+    template <typename T>
+    constexpr bool supersedes(const T& newer, const T& older) const
+    {
+        return compare(older, newer);
+    }
+};
+
+// Sum, accumulated with Neumaier's variant of Kahan summation so that the rounding errors of
+// adding each element and subtracting it again when it leaves the window do not build up
+struct CompensatedSum
+{
+    template <typename T>
+    constexpr T operator()(const T& lhs, const T& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+}  // namespace fixed_containers::sliding_window_ops
+
+namespace fixed_containers::fixed_sliding_window_detail
+{
+template <typename Op, typename T>
+concept SelectionOp = requires(const Op& op, const T& value) {
+    { op.supersedes(value, value) } -> std::convertible_to<bool>;
+};
+
+template <typename Op>
+concept CompensatedSumOp = std::same_as<Op, sliding_window_ops::CompensatedSum>;
+
+// Each aggregator is told about an element before it is pushed to `values`, and about the front
+// of `values` before it is popped.
+
+// For selections such as min and max: the candidates are the elements that no newer element
+// supersedes, from oldest to newest. The front one is the result.
+template <typename T, std::size_t MAXIMUM_SIZE>
+struct MonotonicAggregator
+{
+    FixedDeque<T, MAXIMUM_SIZE> candidates{};
+
+    template <typename Op, typename Values>
+    constexpr void push(const Op& op, const Values& /*values*/, const T& value)
+    {
+        while (!candidates.empty() && op.supersedes(value, candidates.back()))
+        {
+            candidates.pop_back();
+        }
+        candidates.push_back(value);
+    }
+
+    template <typename Op, typename Values>
+    constexpr void pop(const Op& op, const Values& values)
+    {
+        // Unless something newer superseded it, the oldest element is the oldest candidate
+        if (!op.supersedes(candidates.front(), values.front()))
+        {
+            candidates.pop_front();
+        }
+    }
+
+    template <typename Op, typename Values>
+    [[nodiscard]] constexpr T aggregate(const Op& /*op*/, const Values& /*values*/) const
+    {
+        return candidates.front();
+    }
+
+    constexpr void clear() { candidates.clear(); }
+};
+
+// For sums: the running sum and its compensation, to which elements are added when they enter the
+// window and from which they are subtracted when they leave it.
+template <typename T>
+struct CompensatedSumAggregator
+{
+    T sum{};
+    T compensation{};
+
+    template <typename Op, typename Values>
+    constexpr void push(const Op& /*op*/, const Values& /*values*/, const T& value)
+    {
+        add(value);
+    }
+
+    template <typename Op, typename Values>
+    constexpr void pop(const Op& /*op*/, const Values& values)
+    {
+        add(-values.front());
+    }
+
+    template <typename Op, typename Values>
+    [[nodiscard]] constexpr T aggregate(const Op& /*op*/, const Values& /*values*/) const
+    {
+        return sum + compensation;
+    }
+
+    constexpr void clear()
+    {
+        sum = T{};
+        compensation = T{};
+    }
+
+private:
+    static constexpr T magnitude(const T& value) { return value < T{} ? -value : value; }
+
+    constexpr void add(const T& value)
+    {
+        const T new_sum = sum + value;
+        // Recover the low-order bits of whichever operand was rounded off
+        if (magnitude(sum) >= magnitude(value))
+        {
+            compensation += (sum - new_sum) + value;
+        }
+        else
+        {
+            compensation += (value - new_sum) + sum;
+        }
+        sum = new_sum;
+    }
+};
+
+// For any associative operation, with two stacks: the oldest elements form the front stack, which
+// stores for each element the aggregate from it up to the newest element of that stack; the newer
+// elements form the back stack, of which only the aggregate is kept. When the front stack runs out,
+// all elements are moved into it at once, which is amortized O(1) per element.
+template <typename T, std::size_t MAXIMUM_SIZE>
+struct TwoStackAggregator
+{
+    static_assert(std::default_initializable<T>,
+                  "The aggregate of the back stack needs an initial value");
+
+    // Its size is the size of the front stack
+    FixedDeque<T, MAXIMUM_SIZE> front_aggregates{};
+    T back_aggregate{};
+
+    template <typename Op, typename Values>
+    constexpr void push(const Op& op, const Values& values, const T& value)
+    {
+        back_aggregate = back_stack_size(values) == 0 ? value : op(back_aggregate, value);
+    }
+
+    template <typename Op, typename Values>
+    constexpr void pop(const Op& op, const Values& values)
+    {
+        if (front_aggregates.empty())
+        {
+            auto it = values.crbegin();
+            T suffix_aggregate = *it;
+            front_aggregates.push_front(suffix_aggregate);
+            for (++it; it != values.crend(); ++it)
+            {
+                suffix_aggregate = op(*it, suffix_aggregate);
+                front_aggregates.push_front(suffix_aggregate);
+            }
+        }
+        front_aggregates.pop_front();
+    }
+
+    template <typename Op, typename Values>
+    [[nodiscard]] constexpr T aggregate(const Op& op, const Values& values) const
+    {
+        if (front_aggregates.empty())
+        {
+            return back_aggregate;
+        }
+        if (back_stack_size(values) == 0)
+        {
+            return front_aggregates.front();
+        }
+        return op(front_aggregates.front(), back_aggregate);
+    }
+
+    constexpr void clear() { front_aggregates.clear(); }
+
+private:
+    template <typename Values>
+    [[nodiscard]] constexpr std::size_t back_stack_size(const Values& values) const
+    {
+        return values.size() - front_aggregates.size();
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename Op>
+using AggregatorFor =
+    std::conditional_t<SelectionOp<Op, T>,
+                       MonotonicAggregator<T, MAXIMUM_SIZE>,
+                       std::conditional_t<CompensatedSumOp<Op>,
+                                          CompensatedSumAggregator<T>,
+                                          TwoStackAggregator<T, MAXIMUM_SIZE>>>;
+}  // namespace fixed_containers::fixed_sliding_window_detail
+
+namespace fixed_containers
+{
+/**
+ * The last (up to) `MAXIMUM_SIZE` elements pushed, together with their aggregate under the
+ * associative operation `Op`, in amortized O(1) per push instead of rescanning the window. How
+ * the aggregate is maintained depends on `Op`:
+ *  - `sliding_window_ops::Min` and `Max` (or anything with a `supersedes()` like theirs) keep a
+ *    monotonic deque of the elements that can still become the result
+ *  - `sliding_window_ops::CompensatedSum` keeps a compensated running sum; the mean is
+ *    `aggregate() / size()`
+ *  - any other operation, which needs not be commutative or invertible, uses two stacks
+ *
+ * Like `FixedCircularDeque`, pushing to a full window evicts the oldest element. All storage is
+ * fixed; the min/max and two-stack variants use a second deque of the same capacity.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Op,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedSlidingWindow
+{
+    using Checking = CheckingType;
+    using ValuesType = FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>;
+    using Aggregator = fixed_sliding_window_detail::AggregatorFor<T, MAXIMUM_SIZE, Op>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using const_iterator = typename ValuesType::const_iterator;
+    using operation_type = Op;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    ValuesType IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    Aggregator IMPLEMENTATION_DETAIL_DO_NOT_USE_aggregator_;
+    Op IMPLEMENTATION_DETAIL_DO_NOT_USE_operation_;
+
+public:
+    constexpr FixedSlidingWindow() noexcept
+      : FixedSlidingWindow(Op{})
+    {
+    }
+
+    explicit constexpr FixedSlidingWindow(const Op& operation) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_aggregator_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_operation_{operation}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return values().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return values().empty(); }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return values().cbegin(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return values().cend(); }
+
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return values().front(loc);
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return values().back(loc);
+    }
+
+    /**
+     * The aggregate of all elements in the window, from oldest to newest.
+     */
+    [[nodiscard]] constexpr value_type aggregate(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return aggregator().aggregate(operation(), values());
+    }
+
+    /**
+     * Appends the element, evicting the oldest one if the window is full.
+     */
+    constexpr void push_back(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (is_full(values()))
+        {
+            pop_front(loc);
+        }
+        aggregator().push(operation(), values(), value);
+        values().push_back(value, loc);
+    }
+
+    constexpr void pop_front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        aggregator().pop(operation(), values());
+        values().pop_front(loc);
+    }
+
+    constexpr void clear() noexcept
+    {
+        aggregator().clear();
+        values().clear();
+    }
+
+private:
+    [[nodiscard]] constexpr const ValuesType& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr ValuesType& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    [[nodiscard]] constexpr const Aggregator& aggregator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_aggregator_;
+    }
+    constexpr Aggregator& aggregator() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_aggregator_; }
+    [[nodiscard]] constexpr const Op& operation() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_operation_;
+    }
+
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, class Op, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedSlidingWindow<T, MAXIMUM_SIZE, Op, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Op,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedSlidingWindow<T, MAXIMUM_SIZE, Op, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
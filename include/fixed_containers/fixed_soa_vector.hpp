@@ -0,0 +1,585 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
+#include "fixed_containers/reflection.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/tuples.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_soa_vector_detail
+{
+template <typename T>
+inline constexpr std::size_t FIELD_COUNT = reflection::field_count_of<T>();
+
+template <typename T>
+using FieldReferencesOf =
+    decltype(tuples::as_tuple_view<FIELD_COUNT<T>>(std::declval<std::remove_const_t<T>&>()));
+
+template <typename T, std::size_t FIELD_INDEX>
+using FieldType =
+    std::remove_cvref_t<std::tuple_element_t<FIELD_INDEX, FieldReferencesOf<std::decay_t<T>>>>;
+
+// One array per field, nested so that the storage stays a structural type (unlike std::tuple)
+template <std::size_t MAXIMUM_SIZE, typename Field, typename... Fields>
+struct Columns
+{
+    std::array<Field, MAXIMUM_SIZE> head;
+    Columns<MAXIMUM_SIZE, Fields...> tail;
+};
+
+template <std::size_t MAXIMUM_SIZE, typename Field>
+struct Columns<MAXIMUM_SIZE, Field>
+{
+    std::array<Field, MAXIMUM_SIZE> head;
+};
+
+template <std::size_t FIELD_INDEX, typename ColumnsType>
+constexpr auto& column(ColumnsType& columns)
+{
+    if constexpr (FIELD_INDEX == 0)
+    {
+        return columns.head;
+    }
+    else
+    {
+        return column<FIELD_INDEX - 1>(columns.tail);
+    }
+}
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename = std::make_index_sequence<FIELD_COUNT<T>>>
+struct ColumnsFor;
+
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t... FIELD_INDICES>
+struct ColumnsFor<T, MAXIMUM_SIZE, std::index_sequence<FIELD_INDICES...>>
+{
+    using Type = Columns<MAXIMUM_SIZE, FieldType<T, FIELD_INDICES>...>;
+};
+
+// Calls `func(std::integral_constant<std::size_t, I>{})` for each I in [0, COUNT)
+template <std::size_t COUNT, typename Func>
+constexpr void for_each_field_index(Func&& func)
+{
+    [&func]<std::size_t... FIELD_INDICES>(std::index_sequence<FIELD_INDICES...>)
+    {
+        (func(std::integral_constant<std::size_t, FIELD_INDICES>{}), ...);
+    }(std::make_index_sequence<COUNT>{});
+}
+
+/**
+ * Proxy for the element at `index`. Converts to a `T` assembled from the fields, and assigning a
+ * `T` (or another element) scatters the fields into their arrays.
+ */
+template <typename T, typename ColumnsType>
+class SoAReference
+{
+    static constexpr bool IS_CONST = std::is_const_v<ColumnsType>;
+
+    template <typename, typename>
+    friend class SoAReference;
+
+private:
+    ColumnsType* columns_;
+    std::size_t index_;
+
+public:
+    constexpr SoAReference(ColumnsType* columns, const std::size_t index) noexcept
+      : columns_{columns}
+      , index_{index}
+    {
+    }
+
+    template <typename OtherColumnsType>
+        requires(IS_CONST && std::same_as<ColumnsType, const OtherColumnsType>)
+    constexpr SoAReference(const SoAReference<T, OtherColumnsType>& other) noexcept
+      : SoAReference{other.columns_, other.index_}
+    {
+    }
+
+    constexpr SoAReference(const SoAReference&) noexcept = default;
+
+    // Assignment writes through, like assigning to a `T&`
+    constexpr const SoAReference& operator=(const SoAReference& other) const
+        requires(!IS_CONST)
+    {
+        return *this = static_cast<T>(other);
+    }
+    constexpr const SoAReference& operator=(const T& value) const
+        requires(!IS_CONST)
+    {
+        auto fields = tuples::as_tuple_view<FIELD_COUNT<T>>(value);
+        const auto assign_field =
+            [&]<std::size_t FIELD_INDEX>(std::integral_constant<std::size_t, FIELD_INDEX>)
+        { get<FIELD_INDEX>() = std::get<FIELD_INDEX>(fields); };
+        for_each_field_index<FIELD_COUNT<T>>(assign_field);
+        return *this;
+    }
+
+    constexpr ~SoAReference() noexcept = default;
+
+    template <std::size_t FIELD_INDEX>
+    [[nodiscard]] constexpr auto& get() const
+    {
+        return column<FIELD_INDEX>(*columns_)[index_];
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    [[nodiscard]] constexpr operator T() const
+    {
+        T output{};
+        auto fields = tuples::as_tuple_view<FIELD_COUNT<T>>(output);
+        const auto read_field =
+            [&]<std::size_t FIELD_INDEX>(std::integral_constant<std::size_t, FIELD_INDEX>)
+        { std::get<FIELD_INDEX>(fields) = get<FIELD_INDEX>(); };
+        for_each_field_index<FIELD_COUNT<T>>(read_field);
+        return output;
+    }
+};
+
+template <typename T, typename ColumnsType>
+class ReferenceProvider
+{
+    template <typename, typename>
+    friend class ReferenceProvider;
+
+private:
+    ColumnsType* columns_;
+    std::size_t current_index_;
+
+public:
+    constexpr ReferenceProvider() noexcept
+      : ReferenceProvider{nullptr, 0}
+    {
+    }
+
+    constexpr ReferenceProvider(ColumnsType* columns, const std::size_t current_index) noexcept
+      : columns_{columns}
+      , current_index_{current_index}
+    {
+    }
+
+    template <typename OtherColumnsType>
+        requires(std::same_as<ColumnsType, const OtherColumnsType>)
+    constexpr ReferenceProvider(
+        const ReferenceProvider<T, OtherColumnsType>& mutable_other) noexcept
+      : ReferenceProvider{mutable_other.columns_, mutable_other.current_index_}
+    {
+    }
+
+    constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
+    constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+
+    [[nodiscard]] constexpr SoAReference<T, ColumnsType> get() const noexcept
+    {
+        return {columns_, current_index_};
+    }
+
+    template <typename OtherColumnsType>
+    constexpr bool operator==(const ReferenceProvider<T, OtherColumnsType>& other) const noexcept
+    {
+        assert_or_abort(columns_ == other.columns_);
+        return current_index_ == other.current_index_;
+    }
+    template <typename OtherColumnsType>
+    constexpr auto operator<=>(const ReferenceProvider<T, OtherColumnsType>& other) const noexcept
+    {
+        assert_or_abort(columns_ == other.columns_);
+        return current_index_ <=> other.current_index_;
+    }
+
+    template <typename OtherColumnsType>
+    constexpr std::ptrdiff_t operator-(const ReferenceProvider<T, OtherColumnsType>& other) const
+    {
+        assert_or_abort(columns_ == other.columns_);
+        return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
+    }
+};
+}  // namespace fixed_containers::fixed_soa_vector_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity vector of an aggregate `T`, stored as a structure of arrays: each field of `T`
+ * (as found by `reflection`) lives in its own contiguous array. Loops that only touch a few fields
+ * read only those arrays, instead of striding over whole elements, and can be vectorized.
+ *
+ * The interface follows `FixedVector`. Since there is no `T` object in the storage, elements are
+ * accessed through proxies (`reference`) that convert to and can be assigned from `T`, and whose
+ * fields are reachable with `get<FIELD_INDEX>()`. Whole columns are available as spans through
+ * `field<FIELD_INDEX>()`.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+    requires(reflection::Reflectable<T> && fixed_soa_vector_detail::FIELD_COUNT<T> > 0)
+class FixedSoAVector
+{
+    static constexpr std::size_t FIELD_COUNT = fixed_soa_vector_detail::FIELD_COUNT<T>;
+    using Checking = CheckingType;
+    using Columns = typename fixed_soa_vector_detail::ColumnsFor<T, MAXIMUM_SIZE>::Type;
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        RandomAccessIterator<fixed_soa_vector_detail::ReferenceProvider<T, const Columns>,
+                             fixed_soa_vector_detail::ReferenceProvider<T, Columns>,
+                             CONSTNESS,
+                             DIRECTION>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = fixed_soa_vector_detail::SoAReference<T, Columns>;
+    using const_reference = fixed_soa_vector_detail::SoAReference<T, const Columns>;
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+
+    template <std::size_t FIELD_INDEX>
+    using field_type = fixed_soa_vector_detail::FieldType<T, FIELD_INDEX>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Columns IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedSoAVector() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+    {
+    }
+
+    constexpr FixedSoAVector(
+        std::initializer_list<T> list,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedSoAVector()
+    {
+        for (const T& value : list)
+        {
+            push_back(value, loc);
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    constexpr iterator begin() noexcept { return create_iterator<iterator>(0); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_iterator<const_iterator>(0);
+    }
+    constexpr iterator end() noexcept { return create_iterator<iterator>(size()); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_iterator<const_iterator>(size());
+    }
+
+    constexpr reverse_iterator rbegin() noexcept
+    {
+        return create_iterator<reverse_iterator>(size());
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_iterator<const_reverse_iterator>(size());
+    }
+    constexpr reverse_iterator rend() noexcept { return create_iterator<reverse_iterator>(0); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_iterator<const_reverse_iterator>(0);
+    }
+
+    constexpr reference operator[](size_type index) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type index) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type index,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_index(index, loc);
+        return {std::addressof(columns()), index};
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type index,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_index(index, loc);
+        return {std::addressof(columns()), index};
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return {std::addressof(columns()), 0};
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return {std::addressof(columns()), 0};
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return {std::addressof(columns()), size() - 1};
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return {std::addressof(columns()), size() - 1};
+    }
+
+    /**
+     * The contiguous array of the field at `FIELD_INDEX`, for the elements currently in the
+     * container.
+     */
+    template <std::size_t FIELD_INDEX>
+    constexpr std::span<field_type<FIELD_INDEX>> field() noexcept
+    {
+        return {fixed_soa_vector_detail::column<FIELD_INDEX>(columns()).data(), size()};
+    }
+    template <std::size_t FIELD_INDEX>
+    [[nodiscard]] constexpr std::span<const field_type<FIELD_INDEX>> field() const noexcept
+    {
+        return {fixed_soa_vector_detail::column<FIELD_INDEX>(columns()).data(), size()};
+    }
+
+    /**
+     * Appends the given element value to the end of the container.
+     * Calling push_back on a full container is undefined.
+     */
+    constexpr void push_back(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        back() = value;
+    }
+
+    /**
+     * Removes the last element of the container.
+     * Calling pop_back on an empty container is undefined.
+     */
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        reset_tail(size() - 1);
+    }
+
+    /**
+     * Erases the specified range of elements from the container. Each field array is shifted
+     * separately.
+     */
+    constexpr iterator erase(const_iterator first,
+                             const_iterator last,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(first <= last))
+        {
+            Checking::invalid_argument("first > last, range is invalid", loc);
+        }
+        if (preconditions::test(first >= cbegin() && last <= cend()))
+        {
+            Checking::invalid_argument("iterators exceed container range", loc);
+        }
+
+        const auto first_index = static_cast<std::size_t>(std::distance(cbegin(), first));
+        const auto last_index = static_cast<std::size_t>(std::distance(cbegin(), last));
+        for_each_column(
+            [&](auto& column)
+            {
+                std::move(std::next(column.begin(), static_cast<std::ptrdiff_t>(last_index)),
+                          std::next(column.begin(), static_cast<std::ptrdiff_t>(size())),
+                          std::next(column.begin(), static_cast<std::ptrdiff_t>(first_index)));
+            });
+        reset_tail(size() - (last_index - first_index));
+        return create_iterator<iterator>(first_index);
+    }
+
+    /**
+     * Erases the element at position pos from the container.
+     */
+    constexpr iterator erase(const_iterator pos,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        return erase(pos, std::next(pos), loc);
+    }
+
+    /**
+     * Erases the element at `pos` by moving the last element into its place, in O(1). Does not
+     * preserve the order of the elements. Returns an iterator to the element that took the place
+     * of the erased one, or `end()`.
+     */
+    constexpr iterator unordered_erase(const_iterator pos,
+                                       const std_transition::source_location& loc =
+                                           std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(pos >= cbegin() && pos < cend()))
+        {
+            Checking::invalid_argument("iterator exceeds container range", loc);
+        }
+
+        const auto index = static_cast<std::size_t>(std::distance(cbegin(), pos));
+        const std::size_t last_index = size() - 1;
+        if (index != last_index)
+        {
+            for_each_column([&](auto& column)
+                            { column[index] = std::move(column[last_index]); });
+        }
+        reset_tail(last_index);
+        return create_iterator<iterator>(index);
+    }
+
+    constexpr void clear() noexcept { reset_tail(0); }
+
+    template <std::size_t MAXIMUM_SIZE_2, typename CheckingType2>
+    constexpr bool operator==(
+        const FixedSoAVector<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        bool are_equal = true;
+        fixed_soa_vector_detail::for_each_field_index<FIELD_COUNT>(
+            [&]<std::size_t FIELD_INDEX>(std::integral_constant<std::size_t, FIELD_INDEX>)
+            {
+                are_equal = are_equal && std::ranges::equal(field<FIELD_INDEX>(),
+                                                            other.template field<FIELD_INDEX>());
+            });
+        return are_equal;
+    }
+
+private:
+    [[nodiscard]] constexpr const Columns& columns() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_;
+    }
+    constexpr Columns& columns() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_; }
+
+    template <typename IteratorType>
+    constexpr IteratorType create_iterator(const std::size_t start_index) const noexcept
+    {
+        return IteratorType{std::addressof(columns()), start_index};
+    }
+
+    template <typename IteratorType>
+    constexpr IteratorType create_iterator(const std::size_t start_index) noexcept
+    {
+        return IteratorType{std::addressof(columns()), start_index};
+    }
+
+    template <typename Func>
+    constexpr void for_each_column(Func&& func)
+    {
+        fixed_soa_vector_detail::for_each_field_index<FIELD_COUNT>(
+            [&]<std::size_t FIELD_INDEX>(std::integral_constant<std::size_t, FIELD_INDEX>)
+            { func(fixed_soa_vector_detail::column<FIELD_INDEX>(columns())); });
+    }
+
+    // Shrinks to `new_size`. Vacated slots are reset, so that fields owning resources release them.
+    constexpr void reset_tail(const std::size_t new_size)
+    {
+        for_each_column(
+            [&](auto& column)
+            {
+                using Field = typename std::remove_cvref_t<decltype(column)>::value_type;
+                if constexpr (!std::is_trivially_destructible_v<Field>)
+                {
+                    for (std::size_t i = new_size; i < size(); i++)
+                    {
+                        column[i] = Field{};
+                    }
+                }
+            });
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = new_size;
+    }
+
+    constexpr void check_index(const std::size_t index,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
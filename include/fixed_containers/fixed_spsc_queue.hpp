@@ -0,0 +1,262 @@
+#pragma once
+
+#include "fixed_containers/algorithm.hpp"
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/circular_indexing.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace fixed_containers::fixed_spsc_queue_detail
+{
+// The index owned by one side of the queue, together with that side's last observed value of the
+// index owned by the other side. The cached copy is only refreshed when it is not enough to
+// complete an operation, so in the common case neither side reads the other side's cache line.
+struct alignas(CACHE_LINE_SIZE) SideState
+{
+    std::atomic<std::size_t> own_index{0};
+    std::size_t cached_other_index{0};
+};
+}  // namespace fixed_containers::fixed_spsc_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity, lock-free, single-producer single-consumer queue. Properties:
+ *  - wait-free `try_*` operations that fail instead of blocking when full or empty
+ *  - at most one thread may call the producer functions (`try_push*`, `try_emplace`) and at most
+ *    one thread may call the consumer functions (`try_pop*`) at the same time
+ *  - no pointers stored and no dynamic allocations, so it can be placed in shared memory
+ *
+ * The producer's and the consumer's indices live on separate cache lines. They count every push
+ * and pop without wrapping around, and are mapped to the storage with
+ * `circular_indexing::wrap_index()`.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE>
+class FixedSpscQueue
+{
+    static_assert(MAXIMUM_SIZE > 0, "The queue must be able to hold at least one element");
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "Lock-free atomics are needed for use across processes");
+
+    using OptionalT = optional_storage_detail::OptionalStorageTransparent<T>;
+    using SideState = fixed_spsc_queue_detail::SideState;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    // `own_index` is the index of the next push, `cached_other_index` a past index of the front
+    SideState producer_;
+    // `own_index` is the index of the front, `cached_other_index` a past index of the next push
+    SideState consumer_;
+    alignas(CACHE_LINE_SIZE) std::array<OptionalT, MAXIMUM_SIZE> array_;
+
+public:
+    FixedSpscQueue() noexcept
+      : producer_{}
+      , consumer_{}
+    // Don't initialize the array
+    {
+    }
+
+    FixedSpscQueue(const FixedSpscQueue&) = delete;
+    FixedSpscQueue(FixedSpscQueue&&) = delete;
+    FixedSpscQueue& operator=(const FixedSpscQueue&) = delete;
+    FixedSpscQueue& operator=(FixedSpscQueue&&) = delete;
+
+    ~FixedSpscQueue() noexcept
+    {
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            const std::size_t tail = producer_.own_index.load(std::memory_order_acquire);
+            for (std::size_t head = consumer_.own_index.load(std::memory_order_relaxed);
+                 head != tail;
+                 head++)
+            {
+                memory::destroy_at_address_of(slot(head));
+            }
+        }
+    }
+
+    /**
+     * Producer side. Return whether the element was added, which it is not if the queue is full.
+     */
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = producer_.own_index.load(std::memory_order_relaxed);
+        if (free_slot_count(tail, 1) == 0)
+        {
+            return false;
+        }
+        memory::construct_at_address_of(slot(tail), std::forward<Args>(args)...);
+        producer_.own_index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Producer side. Adds up to `count` elements read from `first` and returns how many were
+     * added; exactly that many elements are read. All of them become visible to the consumer at
+     * once. A contiguous source of trivially copyable elements is copied with (at most) two
+     * `memcpy`s.
+     */
+    template <InputIterator InputIt>
+    std::size_t try_push_n(InputIt first, const std::size_t count)
+    {
+        const std::size_t tail = producer_.own_index.load(std::memory_order_relaxed);
+        const std::size_t pushed_count = free_slot_count(tail, count);
+        const std::size_t index = circular_indexing::wrap_index<MAXIMUM_SIZE>(tail);
+        const std::size_t first_segment_size = (std::min)(pushed_count, MAXIMUM_SIZE - index);
+
+        first = construct_n(first, first_segment_size, std::addressof(slot(tail)));
+        construct_n(first,
+                    pushed_count - first_segment_size,
+                    std::addressof(optional_storage_detail::get(array_.front())));
+        producer_.own_index.store(tail + pushed_count, std::memory_order_release);
+        return pushed_count;
+    }
+
+    /**
+     * Consumer side. Removes the front element and returns it, or returns `std::nullopt` if the
+     * queue is empty.
+     */
+    std::optional<value_type> try_pop()
+    {
+        const std::size_t head = consumer_.own_index.load(std::memory_order_relaxed);
+        if (occupied_slot_count(head, 1) == 0)
+        {
+            return std::nullopt;
+        }
+        std::optional<value_type> out{std::move(slot(head))};
+        memory::destroy_at_address_of(slot(head));
+        consumer_.own_index.store(head + 1, std::memory_order_release);
+        return out;
+    }
+
+    /**
+     * Consumer side. Moves up to `count` elements from the front to `d_first` and returns how many
+     * were moved. Trivially copyable elements are moved to a contiguous destination with (at most)
+     * two `memmove`s.
+     */
+    template <typename OutputIt>
+    std::size_t try_pop_n(OutputIt d_first, const std::size_t count)
+    {
+        const std::size_t head = consumer_.own_index.load(std::memory_order_relaxed);
+        const std::size_t popped_count = occupied_slot_count(head, count);
+        const std::size_t index = circular_indexing::wrap_index<MAXIMUM_SIZE>(head);
+        const std::size_t first_segment_size = (std::min)(popped_count, MAXIMUM_SIZE - index);
+
+        d_first = move_out_n(std::addressof(slot(head)), first_segment_size, d_first);
+        move_out_n(std::addressof(optional_storage_detail::get(array_.front())),
+                   popped_count - first_segment_size,
+                   d_first);
+        consumer_.own_index.store(head + popped_count, std::memory_order_release);
+        return popped_count;
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * A snapshot, which may be stale by the time it is used unless called from one of the sides
+     * with the other one idle. The consumer can rely on at least `size()` elements being present
+     * and the producer on at most `size()` elements being present.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        // Loading the front first ensures it is not past the loaded back
+        const std::size_t head = consumer_.own_index.load(std::memory_order_acquire);
+        const std::size_t tail = producer_.own_index.load(std::memory_order_acquire);
+        return tail - head;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    T& slot(const std::size_t unwrapped_index)
+    {
+        return optional_storage_detail::get(
+            array_[circular_indexing::wrap_index<MAXIMUM_SIZE>(unwrapped_index)]);
+    }
+
+    // Producer side: how many of the `wanted` slots are free, reading the consumer's index only if
+    // the cached copy does not show enough of them
+    std::size_t free_slot_count(const std::size_t tail, const std::size_t wanted)
+    {
+        std::size_t free_count = MAXIMUM_SIZE - (tail - producer_.cached_other_index);
+        if (free_count < wanted)
+        {
+            producer_.cached_other_index = consumer_.own_index.load(std::memory_order_acquire);
+            free_count = MAXIMUM_SIZE - (tail - producer_.cached_other_index);
+        }
+        return (std::min)(free_count, wanted);
+    }
+
+    // Consumer side: how many of the `wanted` elements are present, reading the producer's index
+    // only if the cached copy does not show enough of them
+    std::size_t occupied_slot_count(const std::size_t head, const std::size_t wanted)
+    {
+        std::size_t occupied_count = consumer_.cached_other_index - head;
+        if (occupied_count < wanted)
+        {
+            consumer_.cached_other_index = producer_.own_index.load(std::memory_order_acquire);
+            occupied_count = consumer_.cached_other_index - head;
+        }
+        return (std::min)(occupied_count, wanted);
+    }
+
+    template <typename InputIt>
+    static InputIt construct_n(InputIt first, const std::size_t count, T* const destination)
+    {
+        if constexpr (std::contiguous_iterator<InputIt>)
+        {
+            const InputIt last = std::next(first, static_cast<std::ptrdiff_t>(count));
+            algorithm::uninitialized_copy(first, last, destination);
+            return last;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; i++, ++first)
+            {
+                memory::construct_at_address_of(
+                    *std::next(destination, static_cast<std::ptrdiff_t>(i)), *first);
+            }
+            return first;
+        }
+    }
+
+    template <typename OutputIt>
+    static OutputIt move_out_n(T* const source, const std::size_t count, OutputIt d_first)
+    {
+        T* const source_end = std::next(source, static_cast<std::ptrdiff_t>(count));
+        d_first = std::move(source, source_end, d_first);
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                memory::destroy_at_address_of(*std::next(source, static_cast<std::ptrdiff_t>(i)));
+            }
+        }
+        return d_first;
+    }
+};
+
+}  // namespace fixed_containers
@@ -1,17 +1,96 @@
 #pragma once
 
+#include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
-#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/int_math.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/memory.hpp"
 #include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator_transformer.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_search.hpp"
 
+#include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <initializer_list>
 #include <istream>
+#include <iterator>
+#include <limits>
 #include <string_view>
+#include <type_traits>
+
+namespace fixed_containers::fixed_string_detail
+{
+// Strings of up to 255 characters store their length in the last byte of the character array, as
+// the remaining capacity. When the string is full, the remaining capacity is 0, so the same byte
+// doubles as the null terminator. For example, a FixedString<23> is exactly 24 bytes.
+inline constexpr std::size_t MAXIMUM_LENGTH_STORED_IN_LAST_BYTE =
+    (std::numeric_limits<unsigned char>::max)();
+
+template <std::size_t MAXIMUM_LENGTH>
+class FixedStringStorage
+{
+public:
+    using Array = std::array<char, MAXIMUM_LENGTH + 1>;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Array IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_;
+
+public:
+    [[nodiscard]] constexpr const Array& chars() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_;
+    }
+    constexpr Array& chars() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_; }
+
+    [[nodiscard]] constexpr std::size_t length() const
+    {
+        return MAXIMUM_LENGTH - static_cast<unsigned char>(chars()[MAXIMUM_LENGTH]);
+    }
+    constexpr void set_length(const std::size_t length)
+    {
+        chars()[length] = '\0';
+        chars()[MAXIMUM_LENGTH] = static_cast<char>(MAXIMUM_LENGTH - length);
+    }
+};
+
+template <std::size_t MAXIMUM_LENGTH>
+    requires(MAXIMUM_LENGTH > MAXIMUM_LENGTH_STORED_IN_LAST_BYTE)
+class FixedStringStorage<MAXIMUM_LENGTH>
+{
+    using LengthType = int_math::SmallestUnsignedIntegralFor<MAXIMUM_LENGTH>;
+
+public:
+    using Array = std::array<char, MAXIMUM_LENGTH + 1>;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Array IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_;
+    LengthType IMPLEMENTATION_DETAIL_DO_NOT_USE_length_;
+
+public:
+    [[nodiscard]] constexpr const Array& chars() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_;
+    }
+    constexpr Array& chars() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chars_; }
+
+    [[nodiscard]] constexpr std::size_t length() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_length_;
+    }
+    constexpr void set_length(const std::size_t length)
+    {
+        chars()[length] = '\0';
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_length_ = static_cast<LengthType>(length);
+    }
+};
+}  // namespace fixed_containers::fixed_string_detail
 
 namespace fixed_containers
 {
@@ -22,36 +101,38 @@ class FixedString
 {
     using Checking = CheckingType;
     using CharT = char;
-    using Self = FixedString<MAXIMUM_LENGTH, Checking>;
-    using FixedVecStorage = FixedVector<CharT, MAXIMUM_LENGTH + 1, CheckingType>;
+    using Storage = fixed_string_detail::FixedStringStorage<MAXIMUM_LENGTH>;
+    using Array = typename Storage::Array;
+    static constexpr bool ZERO_UNUSED_TAIL = customize::SequenceContainerZeroUnusedTail<Checking>;
 
-    struct ScopedNullTermination
+    struct Mapper
     {
-        Self* self_;
-        std_transition::source_location loc_;
-
-        constexpr ScopedNullTermination(Self* self,
-                                        const std_transition::source_location& loc) noexcept
-          : self_(self)
-          , loc_(loc)
+        constexpr CharT& operator()(CharT& character) const noexcept { return character; }
+        constexpr const CharT& operator()(const CharT& character) const noexcept
         {
+            return character;
         }
-
-        constexpr ~ScopedNullTermination() noexcept { self_->null_terminate(loc_); }
     };
 
+    template <IteratorConstness CONSTNESS>
+    using IteratorImpl = RandomAccessIteratorTransformer<typename Array::const_iterator,
+                                                         typename Array::iterator,
+                                                         Mapper,
+                                                         Mapper,
+                                                         CONSTNESS>;
+
 public:
-    using value_type = typename FixedVecStorage::value_type;
-    using size_type = typename FixedVecStorage::size_type;
-    using difference_type = typename FixedVecStorage::difference_type;
-    using pointer = typename FixedVecStorage::pointer;
-    using const_pointer = typename FixedVecStorage::const_pointer;
-    using reference = typename FixedVecStorage::reference;
-    using const_reference = typename FixedVecStorage::const_reference;
-    using const_iterator = typename FixedVecStorage::const_iterator;
-    using iterator = typename FixedVecStorage::iterator;
-    using reverse_iterator = typename FixedVecStorage::reverse_iterator;
-    using const_reverse_iterator = typename FixedVecStorage::const_reverse_iterator;
+    using value_type = CharT;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = CharT*;
+    using const_pointer = const CharT*;
+    using reference = CharT&;
+    using const_reference = const CharT&;
+    using const_iterator = IteratorImpl<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = IteratorImpl<IteratorConstness::MUTABLE_ITERATOR>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
 public:
     [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_LENGTH; }
@@ -60,25 +141,28 @@ public:
         std::string_view::npos;
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    FixedVecStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    Storage IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
 
 public:
-    constexpr FixedString(const std_transition::source_location& loc =
+    constexpr FixedString(const std_transition::source_location& /*loc*/ =
                               std_transition::source_location::current()) noexcept
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
+    // Don't initialize the characters
     {
-        null_terminate_at_max_length();
-        null_terminate(loc);
+        // A constexpr context requires everything to be initialized.
+        if (std::is_constant_evaluated() || ZERO_UNUSED_TAIL)
+        {
+            memory::construct_at_address_of(storage());
+        }
+        storage().set_length(0);
     }
 
     constexpr FixedString(
         size_type count,
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{count, character, loc}
+      : FixedString(loc)
     {
-        null_terminate_at_max_length();
-        null_terminate(loc);
+        assign(count, character, loc);
     }
 
     constexpr FixedString(
@@ -91,19 +175,17 @@ public:
     constexpr FixedString(
         std::initializer_list<CharT> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{ilist, loc}
+      : FixedString(loc)
     {
-        null_terminate_at_max_length();
-        null_terminate(loc);
+        assign(ilist, loc);
     }
 
     explicit(false) constexpr FixedString(const std::string_view& view,
                                           const std_transition::source_location& loc =
                                               std_transition::source_location::current()) noexcept
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{view.begin(), view.end(), loc}
+      : FixedString(loc)
     {
-        null_terminate_at_max_length();
-        null_terminate(loc);
+        assign(view, loc);
     }
 
     constexpr FixedString& assign(
@@ -111,8 +193,9 @@ public:
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().assign(count, character, loc);
-        null_terminate(loc);
+        check_target_length(count, loc);
+        std::fill_n(begin(), count, character);
+        set_length(count);
         return *this;
     }
     template <class InputIt>
@@ -121,79 +204,80 @@ public:
         InputIt last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().assign(first, last, loc);
-        null_terminate(loc);
-        return *this;
+        clear();
+        return append(first, last, loc);
     }
     constexpr FixedString& assign(
         std::initializer_list<CharT> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().assign(ilist, loc);
-        null_terminate(loc);
-        return *this;
+        return assign(ilist.begin(), ilist.end(), loc);
     }
     constexpr FixedString& assign(
         const std::string_view& view,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().assign(view.begin(), view.end(), loc);
-        null_terminate(loc);
-        return *this;
+        return assign(view.begin(), view.end(), loc);
     }
 
     [[nodiscard]] constexpr reference operator[](size_type index) noexcept
     {
         // Cannot capture real source_location for operator[]
         // This operator should not range-check according to the spec, but we want the extra safety.
-        return vec().at(index, std_transition::source_location::current());
+        return at(index, std_transition::source_location::current());
     }
     [[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
     {
         // Cannot capture real source_location for operator[]
         // This operator should not range-check according to the spec, but we want the extra safety.
-        return vec().at(index, std_transition::source_location::current());
+        return at(index, std_transition::source_location::current());
     }
 
     [[nodiscard]] constexpr reference at(size_type index,
                                          const std_transition::source_location& loc =
                                              std_transition::source_location::current()) noexcept
     {
-        return vec().at(index, loc);
+        check_index(index, loc);
+        return storage().chars()[index];
     }
     [[nodiscard]] constexpr const_reference at(
         size_type index,
         const std_transition::source_location& loc =
             std_transition::source_location::current()) const noexcept
     {
-        return vec().at(index, loc);
+        check_index(index, loc);
+        return storage().chars()[index];
     }
 
     constexpr reference front(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        return vec().front(loc);
+        check_not_empty(loc);
+        return storage().chars()[0];
     }
     [[nodiscard]] constexpr const_reference front(
         const std_transition::source_location& loc =
             std_transition::source_location::current()) const
     {
-        return vec().front(loc);
+        check_not_empty(loc);
+        return storage().chars()[0];
     }
     constexpr reference back(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        return vec().back(loc);
+        check_not_empty(loc);
+        return storage().chars()[length() - 1];
     }
     [[nodiscard]] constexpr const_reference back(
         const std_transition::source_location& loc =
             std_transition::source_location::current()) const
     {
-        return vec().back(loc);
+        check_not_empty(loc);
+        return storage().chars()[length() - 1];
     }
 
-    [[nodiscard]] constexpr const char* data() const noexcept { return vec().data(); }
-    [[nodiscard]] constexpr char* data() noexcept { return vec().data(); }
+    [[nodiscard]] constexpr const char* data() const noexcept { return storage().chars().data(); }
+    [[nodiscard]] constexpr char* data() noexcept { return storage().chars().data(); }
     [[nodiscard]] constexpr const CharT* c_str() const noexcept { return data(); }
 
     explicit(false) constexpr operator std::string_view() const
@@ -201,25 +285,34 @@ public:
         return std::string_view(data(), length());
     }
 
-    constexpr iterator begin() noexcept { return vec().begin(); }
+    constexpr iterator begin() noexcept { return iterator{storage().chars().begin(), Mapper{}}; }
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
-    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return vec().cbegin(); }
-    constexpr iterator end() noexcept { return vec().end(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return const_iterator{storage().chars().cbegin(), Mapper{}};
+    }
+    constexpr iterator end() noexcept { return std::next(begin(), as_difference(length())); }
     [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
-    [[nodiscard]] constexpr const_iterator cend() const noexcept { return vec().cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return std::next(cbegin(), as_difference(length()));
+    }
 
-    constexpr reverse_iterator rbegin() noexcept { return vec().rbegin(); }
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
     [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
     [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
     {
-        return vec().crbegin();
+        return const_reverse_iterator(cend());
     }
-    constexpr reverse_iterator rend() noexcept { return vec().rend(); }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
     [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
-    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return vec().crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
 
     [[nodiscard]] constexpr bool empty() const noexcept { return length() == 0; }
-    [[nodiscard]] constexpr std::size_t length() const noexcept { return vec().size(); }
+    [[nodiscard]] constexpr std::size_t length() const noexcept { return storage().length(); }
     [[nodiscard]] constexpr std::size_t size() const noexcept { return length(); }
     [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
     constexpr void reserve(const std::size_t new_capacity,
@@ -234,19 +327,17 @@ public:
     }
     [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
 
-    constexpr void clear() noexcept
-    {
-        vec().clear();
-        null_terminate(std_transition::source_location::current());
-    }
+    constexpr void clear() noexcept { set_length(0); }
 
     constexpr iterator insert(
         const_iterator pos,
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().insert(pos, character, loc);
+        check_target_length(length() + 1, loc);
+        const iterator gap = open_gap_at(pos, 1);
+        *gap = character;
+        return gap;
     }
     template <InputIterator InputIt>
     constexpr iterator insert(
@@ -255,55 +346,80 @@ public:
         InputIt last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().insert(pos, first, last, loc);
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            check_target_length(length() + count, loc);
+            const iterator gap = open_gap_at(pos, count);
+            std::copy(first, last, gap);
+            return gap;
+        }
+        else
+        {
+            // Single-pass iterators can only be counted while reading them, so append and rotate
+            const auto index = std::distance(cbegin(), pos);
+            const auto old_length = as_difference(length());
+            append(first, last, loc);
+            std::rotate(std::next(begin(), index), std::next(begin(), old_length), end());
+            return std::next(begin(), index);
+        }
     }
     constexpr iterator insert(
         const_iterator pos,
         std::initializer_list<CharT> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().insert(pos, ilist, loc);
+        return insert(pos, ilist.begin(), ilist.end(), loc);
     }
     constexpr iterator insert(
         const_iterator pos,
         std::string_view view,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().insert(pos, view.begin(), view.end(), loc);
+        return insert(pos, view.begin(), view.end(), loc);
     }
 
     constexpr iterator erase(
         const_iterator position,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().erase(position, loc);
+        return erase(position, std::next(position), loc);
     }
     constexpr iterator erase(
         const_iterator first,
         const_iterator last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        const ScopedNullTermination guard{this, loc};
-        return vec().erase(first, last, loc);
+        if (preconditions::test(first <= last))
+        {
+            Checking::invalid_argument("first > last, range is invalid", loc);
+        }
+        if (preconditions::test(first >= cbegin() && last <= cend()))
+        {
+            Checking::invalid_argument("iterators exceed container range", loc);
+        }
+
+        const iterator write_start_it = const_to_mutable_it(first);
+        const iterator write_end_it = std::copy(last, cend(), write_start_it);
+        set_length(static_cast<std::size_t>(std::distance(begin(), write_end_it)));
+        return write_start_it;
     }
 
     constexpr void push_back(
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().push_back(character, loc);
-        null_terminate(loc);
+        check_target_length(length() + 1, loc);
+        const std::size_t old_length = length();
+        storage().chars()[old_length] = character;
+        set_length(old_length + 1);
     }
 
     constexpr void pop_back(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().pop_back(loc);
-        null_terminate(loc);
+        check_not_empty(loc);
+        set_length(length() - 1);
     }
 
     template <class InputIt>
@@ -312,25 +428,30 @@ public:
         InputIt last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().insert(vec().cend(), first, last, loc);
-        null_terminate(loc);
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            insert(cend(), first, last, loc);
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                push_back(*first, loc);
+            }
+        }
         return *this;
     }
     constexpr FixedString& append(
         std::initializer_list<CharT> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().insert(vec().cend(), ilist, loc);
-        null_terminate(loc);
-        return *this;
+        return append(ilist.begin(), ilist.end(), loc);
     }
     constexpr FixedString& append(
         const std::string_view& view,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().insert(vec().cend(), view.begin(), view.end(), loc);
-        null_terminate(loc);
-        return *this;
+        return append(view.begin(), view.end(), loc);
     }
 
     constexpr FixedString& operator+=(CharT character)
@@ -349,33 +470,33 @@ public:
     {
         return append(view, std_transition::source_location::current());
     }
-
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
     [[nodiscard]] constexpr size_type find(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& str,
                                            const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return string_search::find(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT* char_ptr,
                                            size_type pos,
                                            size_type count) const
     {
-        return as_view().find(char_ptr, pos, count);
+        return string_search::find(
+            as_view(), READABLE_BYTES, std::string_view{char_ptr, count}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT* const str, const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return string_search::find(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT character, const size_type pos = 0) const
     {
-        return as_view().find(character, pos);
+        return string_search::find(as_view(), READABLE_BYTES, character, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
                  not std::is_convertible_v<const StringViewLike&, const char*>)
     [[nodiscard]] constexpr size_type find(const StringViewLike& str, const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return string_search::find(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
 
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
@@ -397,7 +518,7 @@ public:
     }
     [[nodiscard]] constexpr size_type rfind(const CharT character, const size_type pos = npos) const
     {
-        return as_view().rfind(character, pos);
+        return string_search::rfind(as_view(), READABLE_BYTES, character, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
@@ -412,23 +533,24 @@ public:
     [[nodiscard]] constexpr size_type find_first_of(
         const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& str, const size_type pos = 0) const
     {
-        return as_view().find_first_of(str, pos);
+        return string_search::find_first_of(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_of(const CharT* char_ptr,
                                                     size_type pos,
                                                     size_type count) const
     {
-        return as_view().find_first_of(char_ptr, pos, count);
+        return string_search::find_first_of(
+            as_view(), READABLE_BYTES, std::string_view{char_ptr, count}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_of(const CharT* const str,
                                                     const size_type pos = 0) const
     {
-        return as_view().find_first_of(str, pos);
+        return string_search::find_first_of(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_of(const CharT character,
                                                     const size_type pos = 0) const
     {
-        return as_view().find_first_of(character, pos);
+        return string_search::find(as_view(), READABLE_BYTES, character, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
@@ -436,30 +558,34 @@ public:
     [[nodiscard]] constexpr size_type find_first_of(const StringViewLike& str,
                                                     const size_type pos = 0) const
     {
-        return as_view().find_first_of(str, pos);
+        return string_search::find_first_of(as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
 
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
     [[nodiscard]] constexpr size_type find_first_not_of(
         const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& str, const size_type pos = 0) const
     {
-        return as_view().find_first_not_of(str, pos);
+        return string_search::find_first_not_of(
+            as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_not_of(const CharT* char_ptr,
                                                         size_type pos,
                                                         size_type count) const
     {
-        return as_view().find_first_not_of(char_ptr, pos, count);
+        return string_search::find_first_not_of(
+            as_view(), READABLE_BYTES, std::string_view{char_ptr, count}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_not_of(const CharT* const str,
                                                         const size_type pos = 0) const
     {
-        return as_view().find_first_not_of(str, pos);
+        return string_search::find_first_not_of(
+            as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find_first_not_of(const CharT character,
                                                         const size_type pos = 0) const
     {
-        return as_view().find_first_not_of(character, pos);
+        return string_search::find_first_not_of(
+            as_view(), READABLE_BYTES, std::string_view{&character, 1}, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
@@ -467,7 +593,8 @@ public:
     [[nodiscard]] constexpr size_type find_first_not_of(const StringViewLike& str,
                                                         const size_type pos = 0) const
     {
-        return as_view().find_first_not_of(str, pos);
+        return string_search::find_first_not_of(
+            as_view(), READABLE_BYTES, std::string_view{str}, pos);
     }
 
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
@@ -540,6 +667,15 @@ public:
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
     constexpr bool operator==(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const
     {
+        if constexpr (has_zeroed_tail_like<MAXIMUM_LENGTH_2, CheckingType2>())
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // With identical zeroed tails, only the lengths can differ (via embedded nulls)
+                return length() == other.length() &&
+                       std::memcmp(data(), other.data(), MAXIMUM_LENGTH) == 0;
+            }
+        }
         return as_view() == std::string_view{other};
     }
     constexpr bool operator==(const CharT* other) const
@@ -552,6 +688,17 @@ public:
     constexpr std::strong_ordering operator<=>(
         const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const noexcept
     {
+        if constexpr (has_zeroed_tail_like<MAXIMUM_LENGTH_2, CheckingType2>())
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // Past the shorter string, the zeroed tail compares like the embedded nulls of the
+                // longer one would. If all bytes compare equal, the shorter string is less.
+                const std::strong_ordering ordering =
+                    algorithm::compare_bytes(data(), other.data(), MAXIMUM_LENGTH);
+                return ordering != 0 ? ordering : length() <=> other.length();
+            }
+        }
         return as_view() <=> other;
     }
     constexpr std::strong_ordering operator<=>(const CharT* other) const noexcept
@@ -616,38 +763,133 @@ public:
         CharT character,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        vec().resize(count, character, loc);
-        null_terminate(loc);
+        check_target_length(count, loc);
+        const std::size_t old_length = length();
+        if (count > old_length)
+        {
+            std::fill(end(), std::next(begin(), as_difference(count)), character);
+        }
+        set_length(count);
+    }
+
+    // Like `resize()`, but new characters are left uninitialized, to be overwritten through
+    // `data()`.
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_length(count, loc);
+        set_length(count);
+    }
+
+    // Appends `count` uninitialized characters and calls `operation(pointer, count)` to overwrite
+    // them. `operation` returns how many characters it wrote, and only those are kept. Similar to
+    // `std::string::resize_and_overwrite()`.
+    template <class Operation>
+    constexpr void append_with(
+        size_type count,
+        Operation operation,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t old_length = length();
+        if (preconditions::test(count <= MAXIMUM_LENGTH - old_length))
+        {
+            Checking::length_error(old_length + count, loc);
+        }
+        set_length(old_length + count);
+        char* const first = std::next(data(), as_difference(old_length));
+        const auto written = static_cast<std::size_t>(operation(first, count));
+        if (preconditions::test(written <= count))
+        {
+            Checking::invalid_argument("operation wrote more characters than appended", loc);
+        }
+        set_length(old_length + written);
     }
 
 private:
-    constexpr void null_terminate(std::size_t n)
+    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
+    static constexpr bool has_zeroed_tail_like()
+    {
+        return ZERO_UNUSED_TAIL && MAXIMUM_LENGTH == MAXIMUM_LENGTH_2 &&
+               customize::SequenceContainerZeroUnusedTail<CheckingType2>;
+    }
+
+    // Vectorized searches may read the whole buffer, including the bytes past the null terminator
+    static constexpr std::size_t READABLE_BYTES = MAXIMUM_LENGTH + 1;
+
+    static constexpr std::ptrdiff_t as_difference(const std::size_t n)
     {
-        // This bypasses the vector's bounds check
-        // This keeps the vector's size equal to the length of the string
-        *std::next(vec().data(), static_cast<std::ptrdiff_t>(n)) = '\0';
+        return static_cast<std::ptrdiff_t>(n);
     }
-    constexpr void null_terminate(const std_transition::source_location& loc)
+
+    static constexpr void check_target_length(const std::size_t target_length,
+                                              const std_transition::source_location& loc)
     {
-        const std::size_t len = length();
-        if (preconditions::test(len <= MAXIMUM_LENGTH))
+        if (preconditions::test(target_length <= MAXIMUM_LENGTH))
         {
-            Checking::length_error(len + 1, loc);
+            Checking::length_error(target_length, loc);
         }
+    }
+    constexpr void check_index(const std::size_t index,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(index < length()))
+        {
+            Checking::out_of_range(index, length(), loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
 
-        null_terminate(length());
+    // Shifts [pos, end) right by `count` and returns an iterator to the gap. Capacity is checked by
+    // the caller.
+    constexpr iterator open_gap_at(const const_iterator pos, const std::size_t count)
+    {
+        const iterator gap = const_to_mutable_it(pos);
+        const iterator old_end = end();
+        set_length(length() + count);
+        std::copy_backward(gap, old_end, end());
+        return gap;
+    }
+
+    constexpr iterator const_to_mutable_it(const const_iterator iterator)
+    {
+        return std::next(begin(), std::distance(cbegin(), iterator));
+    }
+
+    // Also writes the null terminator
+    constexpr void set_length(const std::size_t new_length)
+    {
+        if constexpr (ZERO_UNUSED_TAIL)
+        {
+            const std::size_t old_length = length();
+            if (new_length < old_length)
+            {
+                std::fill(std::next(data(), as_difference(new_length)),
+                          std::next(data(), as_difference(old_length)),
+                          '\0');
+            }
+        }
+        storage().set_length(new_length);
     }
-    constexpr void null_terminate_at_max_length() { null_terminate(MAXIMUM_LENGTH); }
 
     [[nodiscard]] constexpr std::string_view as_view() const { return *this; }
 
-    [[nodiscard]] constexpr const FixedVecStorage& vec() const
+    [[nodiscard]] constexpr const Storage& storage() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
     }
-    constexpr FixedVecStorage& vec() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_; }
+    constexpr Storage& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
 };
 
+template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE<FixedString<MAXIMUM_LENGTH, CheckingType>> = true;
+
 template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
 std::istream& operator>>(std::istream& stream, FixedString<MAXIMUM_LENGTH, CheckingType>& str)
 {
@@ -0,0 +1,486 @@
+#pragma once
+
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace fixed_containers::fixed_timer_wheel_detail
+{
+// Identifies a scheduled timer. The generation tells apart the successive timers that reuse the
+// same index, so that a handle of a timer that already expired or was cancelled is rejected.
+struct TimerHandle
+{
+    std::uint32_t index{};
+    std::uint32_t generation{};
+
+    constexpr bool operator==(const TimerHandle& other) const = default;
+};
+
+template <typename Payload>
+struct TimerEntry
+{
+    Payload payload;
+    std::uint64_t deadline;
+};
+}  // namespace fixed_containers::fixed_timer_wheel_detail
+
+namespace fixed_containers
+{
+/**
+ * Hierarchical timing wheel: up to `MAX_TIMERS` timers, each carrying a `Payload` and expiring at
+ * a deadline measured in ticks. Scheduling, rescheduling and cancelling are O(1); `advance()`
+ * moves the wheel forward to a given tick and outputs the payloads of the timers that expired, in
+ * order of their deadlines.
+ *
+ * Level 0 has one slot per tick for the next `SLOTS` ticks; each slot of level `l` covers
+ * `SLOTS^l` ticks. When the wheel reaches the start of a slot of a higher level, the timers in it
+ * are cascaded, i.e. distributed over the finer slots below. Timers further away than the
+ * `SLOTS^LEVELS` ticks that the wheel spans are parked in the top level and placed again whenever
+ * they are cascaded.
+ *
+ * Each slot is a doubly-linked list threaded through an index chain, like `FixedDoublyLinkedList`,
+ * with one sentinel per slot. No memory is allocated, and the wheel is trivially copyable if the
+ * payload is, so that it can be checkpointed with a `memcpy`.
+ *
+ * `advance()` skips empty level-0 slots with a bitmap of the occupied ones, so it costs O(1) per
+ * expired or cascaded timer plus O(1) per `SLOTS` ticks advanced while the wheel is not empty.
+ */
+template <typename Payload,
+          std::size_t MAX_TIMERS,
+          std::size_t SLOTS = 64,
+          std::size_t LEVELS = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<Payload, MAX_TIMERS>>
+class FixedTimerWheel
+{
+    static_assert(MAX_TIMERS > 0, "The wheel must be able to hold at least one timer");
+    static_assert(SLOTS >= 2 && std::has_single_bit(SLOTS), "SLOTS must be a power of two");
+    static_assert(LEVELS > 0, "The wheel needs at least one level");
+
+    using Checking = CheckingType;
+    using IndexType = std::uint32_t;
+    using Entry = fixed_timer_wheel_detail::TimerEntry<Payload>;
+    using StorageType = FixedIndexBasedPoolStorage<Entry, MAX_TIMERS>;
+    using ChainEntryType = fixed_doubly_linked_list_detail::LinkedListIndices<IndexType>;
+
+    static constexpr std::size_t SLOT_BITS = static_cast<std::size_t>(std::countr_zero(SLOTS));
+    static constexpr std::uint64_t SLOT_MASK = SLOTS - 1;
+    static constexpr std::size_t BUCKET_COUNT = SLOTS * LEVELS;
+    static constexpr std::size_t WORD_BITS = 64;
+    static constexpr std::size_t WORDS_PER_LEVEL = (SLOTS + WORD_BITS - 1) / WORD_BITS;
+
+    // Timers are at [0, MAX_TIMERS) in the chain, followed by the sentinel of each bucket
+    static_assert(MAX_TIMERS + BUCKET_COUNT <= (std::numeric_limits<IndexType>::max)(),
+                  "must be able to index all timers and buckets with IndexType");
+
+public:
+    using payload_type = Payload;
+    using tick_type = std::uint64_t;
+    using size_type = std::size_t;
+    using handle_type = fixed_timer_wheel_detail::TimerHandle;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAX_TIMERS; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    std::array<ChainEntryType, MAX_TIMERS + BUCKET_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+    // Odd while the timer at that index is scheduled
+    std::array<std::uint32_t, MAX_TIMERS> IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_;
+    std::array<std::uint64_t, WORDS_PER_LEVEL * LEVELS> IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_;
+    // The last tick that was processed
+    tick_type IMPLEMENTATION_DETAIL_DO_NOT_USE_now_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedTimerWheel() noexcept
+      : FixedTimerWheel(0)
+    {
+    }
+
+    /**
+     * A wheel whose current tick is `now`, e.g. the current time in milliseconds.
+     */
+    explicit constexpr FixedTimerWheel(const tick_type now) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_now_{now}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+    {
+        for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+        {
+            const IndexType sentinel = sentinel_of(bucket);
+            next_of(sentinel) = sentinel;
+            prev_of(sentinel) = sentinel;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return MAX_TIMERS; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr tick_type now() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_now_;
+    }
+
+    /**
+     * Schedule a timer that expires at `deadline`. A deadline that is not after `now()` expires
+     * on the next tick.
+     */
+    constexpr handle_type schedule(
+        const tick_type deadline,
+        const payload_type& payload,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(!storage().full()))
+        {
+            Checking::length_error(MAX_TIMERS + 1, loc);
+        }
+        const auto index = static_cast<IndexType>(
+            storage().emplace_and_return_index(Entry{payload, earliest_deadline(deadline)}));
+        const std::uint32_t generation = ++generations()[index];
+        link(index, bucket_for(storage().at(index).deadline, now() + 1));
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        return handle_type{index, generation};
+    }
+    constexpr handle_type schedule_after(
+        const tick_type delay,
+        const payload_type& payload,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return schedule(now() + delay, payload, loc);
+    }
+
+    /**
+     * Move a scheduled timer to a new deadline. Return whether the timer was still scheduled.
+     */
+    constexpr bool reschedule(const handle_type handle, const tick_type deadline)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        unlink(handle.index);
+        storage().at(handle.index).deadline = earliest_deadline(deadline);
+        link(handle.index, bucket_for(storage().at(handle.index).deadline, now() + 1));
+        return true;
+    }
+
+    /**
+     * Remove a scheduled timer. Return whether the timer was still scheduled.
+     */
+    constexpr bool cancel(const handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        unlink(handle.index);
+        release(handle.index);
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type handle) const
+    {
+        return handle.index < MAX_TIMERS && generations()[handle.index] == handle.generation &&
+               handle.generation % 2 == 1;
+    }
+
+    /**
+     * Process every tick up to and including `target`: write the payload of each timer that
+     * expires to `out`, in order of deadline (and of scheduling, for equal deadlines), and return
+     * how many there were. Does nothing if `target` is not after `now()`.
+     */
+    template <typename OutputIt>
+    constexpr std::size_t advance(const tick_type target, OutputIt out)
+    {
+        std::size_t expired_count = 0;
+        while (now() < target)
+        {
+            if (empty())
+            {
+                set_now(target);
+                break;
+            }
+
+            const tick_type tick = now() + 1;
+            if (digit_of(tick, 0) == 0)
+            {
+                cascade(tick);
+            }
+            expired_count += expire(tick, out);
+            set_now(tick);
+
+            // Skip the empty level-0 slots, up to the last tick before the next cascade
+            const tick_type limit = (std::min)(target, tick | SLOT_MASK);
+            if (limit > tick)
+            {
+                const std::size_t next_slot =
+                    next_occupied_slot(0, digit_of(tick, 0) + 1, digit_of(limit, 0) + 1);
+                set_now(next_slot == SLOTS ? limit : ((tick & ~SLOT_MASK) | next_slot) - 1);
+            }
+        }
+        return expired_count;
+    }
+
+    constexpr void clear() noexcept
+    {
+        for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+        {
+            const IndexType sentinel = sentinel_of(bucket);
+            IndexType index = next_of(sentinel);
+            while (index != sentinel)
+            {
+                const IndexType next = next_of(index);
+                release(index);
+                index = next;
+            }
+            next_of(sentinel) = sentinel;
+            prev_of(sentinel) = sentinel;
+        }
+        occupied().fill(0);
+    }
+
+private:
+    [[nodiscard]] constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+    [[nodiscard]] constexpr const std::array<std::uint32_t, MAX_TIMERS>& generations() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_;
+    }
+    constexpr std::array<std::uint32_t, MAX_TIMERS>& generations()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_;
+    }
+    constexpr std::array<std::uint64_t, WORDS_PER_LEVEL * LEVELS>& occupied()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_;
+    }
+    [[nodiscard]] constexpr const std::array<std::uint64_t, WORDS_PER_LEVEL * LEVELS>& occupied()
+        const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_;
+    }
+    constexpr void set_now(const tick_type now) { IMPLEMENTATION_DETAIL_DO_NOT_USE_now_ = now; }
+
+    [[nodiscard]] constexpr IndexType& next_of(const IndexType index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_[index].next;
+    }
+    [[nodiscard]] constexpr IndexType& prev_of(const IndexType index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_[index].prev;
+    }
+    static constexpr IndexType sentinel_of(const std::size_t bucket)
+    {
+        return static_cast<IndexType>(MAX_TIMERS + bucket);
+    }
+
+    // The digit of `tick` in base `SLOTS` that selects the slot at `level`
+    static constexpr std::size_t digit_of(const tick_type tick, const std::size_t level)
+    {
+        const std::size_t shift = SLOT_BITS * level;
+        return shift >= std::numeric_limits<tick_type>::digits
+                   ? 0
+                   : static_cast<std::size_t>((tick >> shift) & SLOT_MASK);
+    }
+    // The digits of `tick` above those that select the slot at `level`
+    static constexpr tick_type digits_above(const tick_type tick, const std::size_t level)
+    {
+        const std::size_t shift = SLOT_BITS * (level + 1);
+        return shift >= std::numeric_limits<tick_type>::digits ? 0 : tick >> shift;
+    }
+
+    [[nodiscard]] constexpr tick_type earliest_deadline(const tick_type deadline) const
+    {
+        return (std::max)(deadline, now() + 1);
+    }
+
+    // The bucket for a timer expiring at `deadline`, with `reference` being the first tick that has
+    // not been processed yet. The timer goes to the lowest level at which it is in the same
+    // revolution of the wheel as `reference`; the slot at that level is then still ahead.
+    static constexpr std::size_t bucket_for(const tick_type deadline, const tick_type reference)
+    {
+        for (std::size_t level = 0; level < LEVELS; level++)
+        {
+            if (digits_above(deadline, level) == digits_above(reference, level))
+            {
+                return (level * SLOTS) + digit_of(deadline, level);
+            }
+        }
+        // Beyond the span of the wheel. Park it in the top-level slot that is reached last before
+        // the deadline: the last one of this revolution, or the first one of the next revolution
+        // if this one has no slots left.
+        constexpr std::size_t TOP_LEVEL = LEVELS - 1;
+        const std::size_t slot = digit_of(reference, TOP_LEVEL) == SLOT_MASK ? 0 : SLOT_MASK;
+        return (TOP_LEVEL * SLOTS) + slot;
+    }
+
+    constexpr void set_occupied(const std::size_t bucket)
+    {
+        const std::size_t level = bucket / SLOTS;
+        const std::size_t slot = bucket % SLOTS;
+        occupied()[(level * WORDS_PER_LEVEL) + (slot / WORD_BITS)] |= std::uint64_t{1}
+                                                                       << (slot % WORD_BITS);
+    }
+    constexpr void clear_occupied(const std::size_t bucket)
+    {
+        const std::size_t level = bucket / SLOTS;
+        const std::size_t slot = bucket % SLOTS;
+        occupied()[(level * WORDS_PER_LEVEL) + (slot / WORD_BITS)] &=
+            ~(std::uint64_t{1} << (slot % WORD_BITS));
+    }
+    // The first occupied slot of `level` in [first, last), or `SLOTS` if there is none
+    [[nodiscard]] constexpr std::size_t next_occupied_slot(const std::size_t level,
+                                                           const std::size_t first,
+                                                           const std::size_t last) const
+    {
+        std::size_t slot = first;
+        while (slot < last)
+        {
+            const std::uint64_t word =
+                occupied()[(level * WORDS_PER_LEVEL) + (slot / WORD_BITS)] >> (slot % WORD_BITS);
+            if (word != 0)
+            {
+                const std::size_t found = slot + static_cast<std::size_t>(std::countr_zero(word));
+                return found < last ? found : SLOTS;
+            }
+            slot = (slot / WORD_BITS + 1) * WORD_BITS;
+        }
+        return SLOTS;
+    }
+
+    constexpr void link(const IndexType index, const std::size_t bucket)
+    {
+        const IndexType sentinel = sentinel_of(bucket);
+        const IndexType last = prev_of(sentinel);
+        next_of(last) = index;
+        prev_of(index) = last;
+        next_of(index) = sentinel;
+        prev_of(sentinel) = index;
+        set_occupied(bucket);
+    }
+    constexpr void unlink(const IndexType index)
+    {
+        const IndexType prev = prev_of(index);
+        const IndexType next = next_of(index);
+        next_of(prev) = next;
+        prev_of(next) = prev;
+        // Only the sentinel is left
+        if (prev == next && prev >= MAX_TIMERS)
+        {
+            clear_occupied(prev - MAX_TIMERS);
+        }
+    }
+    constexpr void release(const IndexType index)
+    {
+        storage().delete_at_and_return_repositioned_index(index);
+        ++generations()[index];
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+    }
+
+    // Empty the bucket and call `function` with each of its timers, which may link them anywhere
+    template <typename Function>
+    constexpr void drain(const std::size_t bucket, const Function& function)
+    {
+        const IndexType sentinel = sentinel_of(bucket);
+        IndexType index = next_of(sentinel);
+        next_of(sentinel) = sentinel;
+        prev_of(sentinel) = sentinel;
+        clear_occupied(bucket);
+        // The last timer still links to the sentinel
+        while (index != sentinel)
+        {
+            const IndexType next = next_of(index);
+            function(index);
+            index = next;
+        }
+    }
+
+    // At the start of a slot of level `l`, which is also the start of a slot of each level below,
+    // distribute its timers over the levels below. The highest level goes first, so that its
+    // timers can be distributed again by the next level down.
+    constexpr void cascade(const tick_type tick)
+    {
+        std::size_t top_level = 0;
+        while (top_level + 1 < LEVELS && digit_of(tick, top_level) == 0)
+        {
+            top_level++;
+        }
+        for (std::size_t level = top_level; level > 0; level--)
+        {
+            drain((level * SLOTS) + digit_of(tick, level),
+                  [&](const IndexType index)
+                  { link(index, bucket_for(storage().at(index).deadline, tick)); });
+        }
+    }
+
+    template <typename OutputIt>
+    constexpr std::size_t expire(const tick_type tick, OutputIt& out)
+    {
+        std::size_t expired_count = 0;
+        drain(digit_of(tick, 0),
+              [&](const IndexType index)
+              {
+                  Entry& entry = storage().at(index);
+                  // Only a timer parked beyond the span of a single-level wheel can be early
+                  if (entry.deadline > tick)
+                  {
+                      link(index, bucket_for(entry.deadline, tick + 1));
+                      return;
+                  }
+                  *out = std::move(entry.payload);
+                  ++out;
+                  release(index);
+                  expired_count++;
+              });
+        return expired_count;
+    }
+};
+
+template <typename Payload,
+          std::size_t MAX_TIMERS,
+          std::size_t SLOTS,
+          std::size_t LEVELS,
+          customize::SequenceContainerChecking CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedTimerWheel<Payload, MAX_TIMERS, SLOTS, LEVELS, CheckingType>& container)
+{
+    return container.size() >= MAX_TIMERS;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename Payload,
+          std::size_t MAX_TIMERS,
+          std::size_t SLOTS,
+          std::size_t LEVELS,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedTimerWheel<Payload, MAX_TIMERS, SLOTS, LEVELS, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/int_math.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/memory.hpp"
 #include "fixed_containers/optional_storage.hpp"
@@ -12,7 +13,9 @@
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
@@ -20,6 +23,11 @@
 
 namespace fixed_containers::fixed_vector_detail
 {
+// Byte-sized types whose ordering is the ordering of their unsigned representation
+template <class T>
+concept OrderedAsUnsignedBytes =
+    std::same_as<T, unsigned char> || std::same_as<T, std::byte> || std::same_as<T, char8_t>;
+
 template <class T, class FixedVectorType>
 class FixedVectorBuilder
 {
@@ -102,6 +110,14 @@ class FixedVectorBase
                   "Vector must have a non-const, non-volatile value_type");
     using Checking = CheckingType;
     using Array = std::array<OptionalT, MAXIMUM_SIZE>;
+    // The size is stored in the smallest type that fits, e.g. a single byte for up to 255 elements.
+    // The public `size_type` remains `std::size_t`.
+    using SizeStorageType = int_math::SmallestUnsignedIntegralFor<MAXIMUM_SIZE>;
+    static constexpr bool ZERO_UNUSED_TAIL =
+        customize::SequenceContainerZeroUnusedTail<CheckingType>;
+    static_assert(!ZERO_UNUSED_TAIL || (std::same_as<OptionalT, T> &&
+                                        std::has_unique_object_representations_v<T>),
+                  "A zeroed unused tail requires trivial types that compare like their bytes");
 
     struct Mapper
     {
@@ -150,7 +166,7 @@ private:
     }
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    SizeStorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
     Array IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
 
 public:
@@ -163,7 +179,7 @@ public:
         // while also being in a constexpr context, initialize array.
         if constexpr (!std::same_as<OptionalT, optional_storage_detail::OptionalStorage<T>>)
         {
-            if (std::is_constant_evaluated())
+            if (std::is_constant_evaluated() || ZERO_UNUSED_TAIL)
             {
                 memory::construct_at_address_of(array());
             }
@@ -241,6 +257,54 @@ public:
         }
     }
 
+    /**
+     * Like `resize()`, but new elements are default-initialized instead of value-initialized, so
+     * trivial types are left uninitialized, to be overwritten through `data()`.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+
+        for (std::size_t i = size(); i < count; i++)
+        {
+            memory::default_construct_at_address_of(unchecked_at(i));
+        }
+        while (size() > count)
+        {
+            destroy_at(back_index());
+            decrement_size();
+        }
+        set_size(count);
+    }
+
+    /**
+     * Appends `count` default-initialized elements and calls `operation(pointer, count)` to
+     * overwrite them, e.g. by reading from a socket. `operation` returns how many elements it
+     * wrote, and only those are kept. Similar to `std::string::resize_and_overwrite()`.
+     */
+    template <class Operation>
+    constexpr void append_with(
+        size_type count,
+        Operation operation,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t old_size = size();
+        if (preconditions::test(count <= MAXIMUM_SIZE - old_size))
+        {
+            Checking::length_error(old_size + count, loc);
+        }
+        resize_for_overwrite(old_size + count, loc);
+        const auto written = static_cast<std::size_t>(
+            operation(std::next(data(), static_cast<std::ptrdiff_t>(old_size)), count));
+        if (preconditions::test(written <= count))
+        {
+            Checking::invalid_argument("operation wrote more elements than appended", loc);
+        }
+        resize_for_overwrite(old_size + written, loc);
+    }
+
     /**
      * Appends the given element value to the end of the container.
      * Calling push_back on a full container is undefined.
@@ -432,6 +496,64 @@ public:
         return erase(pos, std::next(pos), loc);
     }
 
+    /**
+     * Erases the specified element by moving the last element into its place, in O(1). The order
+     * of the remaining elements is not preserved. Returns an iterator to the element that took the
+     * place of the erased one (or `end()`, if the last element was erased).
+     */
+    constexpr iterator unordered_erase(const_iterator pos,
+                                       const std_transition::source_location& loc =
+                                           std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(pos >= cbegin() && pos < cend()))
+        {
+            Checking::invalid_argument("iterator exceeds container range", loc);
+        }
+
+        const iterator hole_it = const_to_mutable_it(pos);
+        const iterator last_it = std::prev(end());
+        if (hole_it != last_it)
+        {
+            *hole_it = std::move(*last_it);
+        }
+        destroy_at(back_index());
+        decrement_size();
+        return hole_it;
+    }
+
+    /**
+     * Erases all elements satisfying `predicate`, in a single pass, and returns how many were
+     * erased. Like `std::list::remove_if()`. Runs of surviving elements are relocated as a block,
+     * which is a single `memmove` for trivially relocatable types.
+     */
+    template <class Predicate>
+    constexpr size_type remove_if(Predicate predicate)
+    {
+        const std::size_t original_size = size();
+        if (std::is_constant_evaluated())
+        {
+            // Relocation accesses objects outside their lifetimes, which is rejected at
+            // compile-time (see `erase()`)
+            erase(std::remove_if(begin(), end(), predicate), end());
+            return original_size - size();
+        }
+
+        std::size_t write_index = 0;
+        std::size_t run_start_index = 0;
+        for (std::size_t i = 0; i < original_size; i++)
+        {
+            if (predicate(unchecked_at(i)))
+            {
+                write_index = relocate_run(run_start_index, i, write_index);
+                destroy_at(i);
+                run_start_index = i + 1;
+            }
+        }
+        write_index = relocate_run(run_start_index, original_size, write_index);
+        set_size(write_index);
+        return original_size - write_index;
+    }
+
     /**
      * Erases all elements from the container. After this call, size() returns zero.
      */
@@ -578,6 +700,14 @@ public:
                 return true;
             }
         }
+        if constexpr (has_zeroed_tail_like<MAXIMUM_SIZE_2, CheckingType2>())
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return size() == other.size() &&
+                       std::memcmp(data(), other.data(), sizeof(T) * MAXIMUM_SIZE) == 0;
+            }
+        }
 
         return std::ranges::equal(*this, other);
     }
@@ -585,11 +715,30 @@ public:
     template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
     constexpr auto operator<=>(const FixedVectorBase<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
     {
+        if constexpr (has_zeroed_tail_like<MAXIMUM_SIZE_2, CheckingType2>() &&
+                      OrderedAsUnsignedBytes<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                // Past the shorter vector, the zeroed tail compares like zero elements of the
+                // longer one would. If all bytes compare equal, the shorter vector is less.
+                const std::strong_ordering ordering =
+                    algorithm::compare_bytes(data(), other.data(), MAXIMUM_SIZE);
+                return ordering != 0 ? ordering : size() <=> other.size();
+            }
+        }
         return std::lexicographical_compare_three_way(
             cbegin(), cend(), other.cbegin(), other.cend());
     }
 
 private:
+    template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
+    static constexpr bool has_zeroed_tail_like()
+    {
+        return ZERO_UNUSED_TAIL && MAXIMUM_SIZE == MAXIMUM_SIZE_2 &&
+               customize::SequenceContainerZeroUnusedTail<CheckingType2>;
+    }
+
     constexpr iterator advance_all_after_iterator_by_n(const const_iterator pos,
                                                        const std::size_t n)
     {
@@ -605,6 +754,21 @@ private:
         return read_start_it;
     }
 
+    // Relocates [first_index, last_index) to `write_index` and returns the index past its end
+    constexpr std::size_t relocate_run(const std::size_t first_index,
+                                       const std::size_t last_index,
+                                       const std::size_t write_index)
+    {
+        const auto as_iterator = [this](const std::size_t index)
+        { return std::next(begin(), static_cast<std::ptrdiff_t>(index)); };
+        if (first_index != write_index)
+        {
+            algorithm::uninitialized_relocate(
+                as_iterator(first_index), as_iterator(last_index), as_iterator(write_index));
+        }
+        return write_index + (last_index - first_index);
+    }
+
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
                                        const_iterator pos,
@@ -616,10 +780,7 @@ private:
         check_target_size(size() + entry_count_to_add, loc);
 
         auto write_it = advance_all_after_iterator_by_n(pos, entry_count_to_add);
-        for (auto w_it = write_it; first != last; std::advance(first, 1), std::advance(w_it, 1))
-        {
-            memory::construct_at_address_of(*w_it, *first);
-        }
+        algorithm::uninitialized_copy(first, last, write_it);
         return write_it;
     }
 
@@ -704,17 +865,19 @@ private:
     }
     constexpr Array& array() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
 
-    constexpr void increment_size(const std::size_t n = 1)
+    constexpr void increment_size(const std::size_t n = 1) { set_size(size() + n); }
+    constexpr void decrement_size(const std::size_t n = 1) { set_size(size() - n); }
+    constexpr void set_size(const std::size_t new_size)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
-    }
-    constexpr void decrement_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
-    }
-    constexpr void set_size(const std::size_t size)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        if constexpr (ZERO_UNUSED_TAIL)
+        {
+            // Vacated elements have already been destroyed or relocated
+            for (std::size_t i = new_size; i < size(); i++)
+            {
+                memory::construct_at_address_of(array()[i]);
+            }
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = static_cast<SizeStorageType>(new_size);
     }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
@@ -988,6 +1151,11 @@ public:
     }
 };
 
+// Elements are stored inline, so the vector is as relocatable as they are
+template <typename T, std::size_t MAXIMUM_SIZE, customize::SequenceContainerChecking CheckingType>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE<FixedVector<T, MAXIMUM_SIZE, CheckingType>> =
+    TriviallyRelocatable<T>;
+
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
 [[nodiscard]] constexpr bool is_full(const FixedVector<T, MAXIMUM_SIZE, CheckingType>& container)
 {
@@ -998,18 +1166,14 @@ template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename
 constexpr typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase(
     FixedVector<T, MAXIMUM_SIZE, CheckingType>& container, const U& value)
 {
-    const auto original_size = container.size();
-    container.erase(std::remove(container.begin(), container.end(), value), container.end());
-    return original_size - container.size();
+    return container.remove_if([&value](const T& entry) { return entry == value; });
 }
 
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
 constexpr typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase_if(
     FixedVector<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
 {
-    const auto original_size = container.size();
-    container.erase(std::remove_if(container.begin(), container.end(), predicate), container.end());
-    return original_size - container.size();
+    return container.remove_if(predicate);
 }
 
 /**
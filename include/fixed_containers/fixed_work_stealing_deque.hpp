@@ -0,0 +1,164 @@
+#pragma once
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/circular_indexing.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity work-stealing deque, after Chase and Lev. One thread, the owner, pushes and pops
+ * at the bottom, like a stack; any number of other threads, the thieves, take the oldest elements
+ * from the top with `steal()`. Properties:
+ *  - lock-free; the owner only contends with thieves when a single element is left
+ *  - `push_bottom()` returns false when the deque is full, instead of growing it. The usual way to
+ *    handle that in a task scheduler is to run the task right away.
+ *  - no pointers stored and no dynamic allocations
+ *
+ * Thieves may read an element that the owner is concurrently popping, and find out only afterwards
+ * that they lost the race. The elements are therefore stored as atomics, which restricts them to
+ * types like pointers or indices that have lock-free atomics.
+ *
+ * The memory orderings are sequentially consistent where the algorithm needs a store-load order
+ * (the owner's `pop_bottom()` against `steal()`), rather than relying on standalone fences.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE>
+class FixedWorkStealingDeque
+{
+    static_assert(MAXIMUM_SIZE > 0, "The deque must be able to hold at least one element");
+    static_assert(TriviallyCopyable<T>, "Elements are read racily, so they must be copyable bits");
+    static_assert(std::atomic<T>::is_always_lock_free, "Elements must have lock-free atomics");
+
+    // Signed, because `pop_bottom()` temporarily moves the bottom below the top
+    using Index = std::int64_t;
+    static_assert(std::atomic<Index>::is_always_lock_free);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+private:
+    // Index of the oldest element, only ever incremented. Written by thieves and the owner.
+    alignas(CACHE_LINE_SIZE) std::atomic<Index> top_;
+    // Index one past the newest element. Only written by the owner.
+    alignas(CACHE_LINE_SIZE) std::atomic<Index> bottom_;
+    alignas(CACHE_LINE_SIZE) std::array<std::atomic<T>, MAXIMUM_SIZE> array_;
+
+public:
+    FixedWorkStealingDeque() noexcept
+      : top_{0}
+      , bottom_{0}
+      , array_{}
+    {
+    }
+
+    FixedWorkStealingDeque(const FixedWorkStealingDeque&) = delete;
+    FixedWorkStealingDeque(FixedWorkStealingDeque&&) = delete;
+    FixedWorkStealingDeque& operator=(const FixedWorkStealingDeque&) = delete;
+    FixedWorkStealingDeque& operator=(FixedWorkStealingDeque&&) = delete;
+    ~FixedWorkStealingDeque() = default;
+
+    /**
+     * Owner only. Return whether the element was added, which it is not if the deque is full.
+     */
+    [[nodiscard]] bool push_bottom(const value_type& value) noexcept
+    {
+        const Index bottom = bottom_.load(std::memory_order_relaxed);
+        const Index top = top_.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<Index>(MAXIMUM_SIZE))
+        {
+            return false;
+        }
+        slot(bottom).store(value, std::memory_order_relaxed);
+        // Publishes the element, and whatever it refers to, to the thieves
+        bottom_.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Owner only. Remove the newest element and return it, or return `std::nullopt` if the deque
+     * is empty.
+     */
+    std::optional<value_type> pop_bottom() noexcept
+    {
+        const Index bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        // Reserve the bottom element before looking at the top, so that from here on thieves
+        // either see it reserved or have already taken it
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        Index top = top_.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            // Was empty
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<value_type> out{slot(bottom).load(std::memory_order_relaxed)};
+        if (top == bottom)
+        {
+            // The last element, which thieves may be trying to take as well: race them for it
+            if (!top_.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                out.reset();
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    /**
+     * Any thread. Remove the oldest element and return it, or return `std::nullopt` if the deque
+     * is empty or another thread took that element first.
+     */
+    std::optional<value_type> steal() noexcept
+    {
+        Index top = top_.load(std::memory_order_seq_cst);
+        const Index bottom = bottom_.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+        {
+            return std::nullopt;
+        }
+
+        // May be stale if another thread takes it first, in which case the exchange below fails
+        const value_type value = slot(top).load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * A snapshot, which may be stale by the time it is used unless called by the owner while there
+     * are no thieves.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const Index top = top_.load(std::memory_order_acquire);
+        const Index bottom = bottom_.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    std::atomic<T>& slot(const Index index)
+    {
+        return array_[circular_indexing::wrap_index<MAXIMUM_SIZE>(static_cast<std::size_t>(index))];
+    }
+};
+
+}  // namespace fixed_containers
@@ -3,6 +3,10 @@
 #include "fixed_containers/assert_or_abort.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace fixed_containers::int_math
 {
@@ -98,4 +102,16 @@ constexpr T divide_integers_rounding_up(const T dividend, const T divisor)
     return ((dividend - static_cast<T>(1)) / divisor) + static_cast<T>(1);
 }
 
+// The smallest unsigned integral type that can hold all values in [0, MAXIMUM_VALUE]
+template <std::size_t MAXIMUM_VALUE>
+using SmallestUnsignedIntegralFor = std::conditional_t<
+    MAXIMUM_VALUE <= (std::numeric_limits<std::uint8_t>::max)(),
+    std::uint8_t,
+    std::conditional_t<
+        MAXIMUM_VALUE <= (std::numeric_limits<std::uint16_t>::max)(),
+        std::uint16_t,
+        std::conditional_t<MAXIMUM_VALUE <= (std::numeric_limits<std::uint32_t>::max)(),
+                           std::uint32_t,
+                           std::size_t>>>;
+
 }  // namespace fixed_containers::int_math
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <new>
+#include <type_traits>
 
 namespace fixed_containers::memory
 {
@@ -18,6 +20,20 @@ constexpr void construct_at_address_of(T& ref, Args&&... args)
     std::construct_at(std::addressof(ref), std::forward<Args>(args)...);
 }
 
+// Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_default_construct
+// but for a single object, so trivial types are left uninitialized. Constant evaluation does not
+// allow uninitialized values, so the object is value-initialized there instead.
+template <typename T>
+constexpr void default_construct_at_address_of(T& ref)
+{
+    if (std::is_constant_evaluated())
+    {
+        construct_at_address_of(ref);
+        return;
+    }
+    ::new (static_cast<void*>(std::addressof(ref))) T;
+}
+
 // Similar to https://en.cppreference.com/w/cpp/memory/destroy_at
 // but uses references and correctly handles types that overload operator&
 template <typename T>
@@ -34,6 +50,19 @@ constexpr void destroy_and_construct_at_address_of(T& ref, Args&&... args)
     construct_at_address_of(ref, std::forward<Args>(args)...);
 }
 
+// Hints that `ref` is about to be read. No-op during constant evaluation and on compilers without
+// `__builtin_prefetch`.
+template <typename T>
+constexpr void prefetch_address_of([[maybe_unused]] const T& ref) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (!std::is_constant_evaluated())
+    {
+        __builtin_prefetch(std::addressof(ref));
+    }
+#endif
+}
+
 template <typename T>
 const std::byte* addressof_as_const_byte_ptr(T& ref)
 {
@@ -20,6 +20,14 @@ concept SequenceContainerChecking = requires(std::size_t index,
     T::invalid_argument(error_message, loc);  // ~ std::invalid_argument
 };
 
+// Checking types can also opt containers into keeping the unused part of their buffer zeroed, by
+// declaring `static constexpr bool ZERO_UNUSED_TAIL = true;`. Shrinking then also clears the
+// vacated elements, but equality between containers of the same capacity becomes a fixed-size
+// `memcmp` of the whole buffer. Supported by `FixedString`, and by `FixedVector` of types with
+// unique object representations.
+template <class T>
+concept SequenceContainerZeroUnusedTail = requires { requires T::ZERO_UNUSED_TAIL; };
+
 template <typename T, std::size_t /*MAXIMUM_SIZE*/>
 struct SequenceContainerAbortChecking
 {
@@ -52,4 +60,11 @@ struct SequenceContainerAbortChecking
         std::abort();
     }
 };
+
+template <typename T, std::size_t MAXIMUM_SIZE>
+struct SequenceContainerZeroUnusedTailAbortChecking
+  : public SequenceContainerAbortChecking<T, MAXIMUM_SIZE>
+{
+    static constexpr bool ZERO_UNUSED_TAIL = true;
+};
 }  // namespace fixed_containers::customize
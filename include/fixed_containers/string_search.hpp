@@ -0,0 +1,332 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FIXED_CONTAINERS_STRING_SEARCH_SSE2
+#endif
+
+// Search functions with the same results as their `std::string_view` counterparts, for strings that
+// live in a fixed-size buffer. `readable_length` is the number of addressable bytes starting at
+// `haystack.data()`, which may exceed `haystack.size()`. This lets vector loads read whole blocks
+// past the end of the string (matches there are discarded) instead of finishing with a byte loop.
+//
+// At runtime and with SSE2 available, 16 bytes are compared at a time:
+//  - single characters are compared against the whole block
+//  - character sets of up to `MAXIMUM_VECTORIZED_SET_SIZE` characters OR the per-character
+//    comparisons. Larger sets use a 256-bit membership table instead.
+//  - substrings are filtered on their first and last characters, and only the candidate positions
+//    are compared in full
+// During constant evaluation (or without SSE2), the `std::string_view` functions are used.
+namespace fixed_containers::string_search_detail
+{
+inline constexpr std::size_t NPOS = std::string_view::npos;
+inline constexpr std::size_t MAXIMUM_VECTORIZED_SET_SIZE = 8;
+
+class CharacterSet
+{
+    std::array<std::uint64_t, 4> bits_{};
+
+public:
+    explicit constexpr CharacterSet(const std::string_view characters)
+    {
+        for (const char character : characters)
+        {
+            const auto byte = static_cast<unsigned char>(character);
+            bits_.at(byte / 64U) |= std::uint64_t{1} << (byte % 64U);
+        }
+    }
+
+    [[nodiscard]] constexpr bool contains(const char character) const
+    {
+        const auto byte = static_cast<unsigned char>(character);
+        return ((bits_.at(byte / 64U) >> (byte % 64U)) & 1U) != 0;
+    }
+};
+
+[[nodiscard]] constexpr std::size_t find_in_set(const std::string_view haystack,
+                                                const std::string_view characters,
+                                                const std::size_t pos,
+                                                const bool is_member_wanted)
+{
+    const CharacterSet set{characters};
+    for (std::size_t i = pos; i < haystack.size(); i++)
+    {
+        if (set.contains(haystack[i]) == is_member_wanted)
+        {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+inline constexpr std::size_t BLOCK_SIZE = sizeof(__m128i);
+
+inline const char* address_at(const char* data, const std::size_t index)
+{
+    return std::next(data, static_cast<std::ptrdiff_t>(index));
+}
+
+inline __m128i load_block(const char* data, const std::size_t index)
+{
+    __m128i block{};
+    std::memcpy(&block, address_at(data, index), BLOCK_SIZE);
+    return block;
+}
+
+// Bit i is set if byte i of `block` equals the (broadcast) byte in `pattern`
+inline std::uint32_t equal_bytes(const __m128i block, const __m128i pattern)
+{
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+}
+
+// Bits for the first `count` bytes of a block
+inline std::uint32_t first_bytes(const std::size_t count)
+{
+    return count >= BLOCK_SIZE ? 0xFFFFU : (std::uint32_t{1} << count) - 1U;
+}
+
+inline std::size_t find_character(const std::string_view haystack,
+                                  const std::size_t readable_length,
+                                  const char character,
+                                  const std::size_t pos)
+{
+    const char* data = haystack.data();
+    const std::size_t length = haystack.size();
+    const __m128i pattern = _mm_set1_epi8(character);
+
+    std::size_t i = pos;
+    for (; i < length && i + BLOCK_SIZE <= readable_length; i += BLOCK_SIZE)
+    {
+        const std::uint32_t mask =
+            equal_bytes(load_block(data, i), pattern) & first_bytes(length - i);
+        if (mask != 0)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i < length; i++)
+    {
+        if (haystack[i] == character)
+        {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+inline std::size_t rfind_character(const std::string_view haystack,
+                                   const std::size_t readable_length,
+                                   const char character,
+                                   const std::size_t pos)
+{
+    const char* data = haystack.data();
+    const __m128i pattern = _mm_set1_epi8(character);
+
+    // Search [0, end), from the back
+    std::size_t end = pos < haystack.size() ? pos + 1 : haystack.size();
+    for (; end >= BLOCK_SIZE || (end > 0 && BLOCK_SIZE <= readable_length);)
+    {
+        const std::size_t block_start = end >= BLOCK_SIZE ? end - BLOCK_SIZE : 0;
+        const std::uint32_t mask =
+            equal_bytes(load_block(data, block_start), pattern) & first_bytes(end - block_start);
+        if (mask != 0)
+        {
+            return block_start + static_cast<std::size_t>(std::bit_width(mask)) - 1;
+        }
+        end = block_start;
+    }
+    for (; end > 0; end--)
+    {
+        if (haystack[end - 1] == character)
+        {
+            return end - 1;
+        }
+    }
+    return NPOS;
+}
+
+inline std::size_t find_in_small_set(const std::string_view haystack,
+                                     const std::size_t readable_length,
+                                     const std::string_view characters,
+                                     const std::size_t pos,
+                                     const bool is_member_wanted)
+{
+    const char* data = haystack.data();
+    const std::size_t length = haystack.size();
+    std::size_t i = pos;
+    for (; i < length && i + BLOCK_SIZE <= readable_length; i += BLOCK_SIZE)
+    {
+        const __m128i block = load_block(data, i);
+        std::uint32_t members = 0;
+        for (const char character : characters)
+        {
+            members |= equal_bytes(block, _mm_set1_epi8(character));
+        }
+        const std::uint32_t wanted = is_member_wanted ? members : ~members;
+        const std::uint32_t mask = wanted & first_bytes(length - i);
+        if (mask != 0)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i < length; i++)
+    {
+        if ((characters.find(haystack[i]) != NPOS) == is_member_wanted)
+        {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+inline std::size_t find_substring(const std::string_view haystack,
+                                  const std::size_t readable_length,
+                                  const std::string_view needle,
+                                  const std::size_t pos)
+{
+    const char* data = haystack.data();
+    const std::size_t needle_length = needle.size();
+    const std::size_t last_start = haystack.size() - needle_length;
+    const std::size_t last_offset = needle_length - 1;
+    const __m128i first_pattern = _mm_set1_epi8(needle.front());
+    const __m128i last_pattern = _mm_set1_epi8(needle.back());
+
+    // Compares everything but the first and last characters, which the filter already matched
+    const auto matches_inner = [&](const std::size_t start)
+    {
+        return std::memcmp(address_at(data, start + 1),
+                           address_at(needle.data(), 1),
+                           needle_length - 2) == 0;
+    };
+
+    std::size_t i = pos;
+    for (; i <= last_start && i + last_offset + BLOCK_SIZE <= readable_length; i += BLOCK_SIZE)
+    {
+        std::uint32_t candidates = equal_bytes(load_block(data, i), first_pattern) &
+                                   equal_bytes(load_block(data, i + last_offset), last_pattern) &
+                                   first_bytes(last_start - i + 1);
+        while (candidates != 0)
+        {
+            const std::size_t start = i + static_cast<std::size_t>(std::countr_zero(candidates));
+            if (matches_inner(start))
+            {
+                return start;
+            }
+            candidates &= candidates - 1;
+        }
+    }
+    for (; i <= last_start; i++)
+    {
+        if (haystack[i] == needle.front() && haystack[i + last_offset] == needle.back() &&
+            matches_inner(i))
+        {
+            return i;
+        }
+    }
+    return NPOS;
+}
+#endif
+}  // namespace fixed_containers::string_search_detail
+
+namespace fixed_containers::string_search
+{
+[[nodiscard]] constexpr std::size_t find(const std::string_view haystack,
+                                         [[maybe_unused]] const std::size_t readable_length,
+                                         const char character,
+                                         const std::size_t pos)
+{
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+    if (!std::is_constant_evaluated())
+    {
+        return string_search_detail::find_character(haystack, readable_length, character, pos);
+    }
+#endif
+    return haystack.find(character, pos);
+}
+
+[[nodiscard]] constexpr std::size_t find(const std::string_view haystack,
+                                         [[maybe_unused]] const std::size_t readable_length,
+                                         const std::string_view needle,
+                                         const std::size_t pos)
+{
+    if (needle.size() == 1)
+    {
+        return find(haystack, readable_length, needle.front(), pos);
+    }
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+    // Empty needles, and needles that can not fit, are left to `std::string_view`
+    if (!std::is_constant_evaluated() && needle.size() >= 2 && pos <= haystack.size() &&
+        needle.size() <= haystack.size() - pos)
+    {
+        return string_search_detail::find_substring(haystack, readable_length, needle, pos);
+    }
+#endif
+    return haystack.find(needle, pos);
+}
+
+[[nodiscard]] constexpr std::size_t rfind(const std::string_view haystack,
+                                          [[maybe_unused]] const std::size_t readable_length,
+                                          const char character,
+                                          const std::size_t pos)
+{
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+    if (!std::is_constant_evaluated())
+    {
+        return string_search_detail::rfind_character(haystack, readable_length, character, pos);
+    }
+#endif
+    return haystack.rfind(character, pos);
+}
+
+[[nodiscard]] constexpr std::size_t find_first_of(
+    const std::string_view haystack,
+    [[maybe_unused]] const std::size_t readable_length,
+    const std::string_view characters,
+    const std::size_t pos)
+{
+    if (std::is_constant_evaluated() || characters.empty())
+    {
+        return haystack.find_first_of(characters, pos);
+    }
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+    if (characters.size() <= string_search_detail::MAXIMUM_VECTORIZED_SET_SIZE)
+    {
+        return string_search_detail::find_in_small_set(
+            haystack, readable_length, characters, pos, true);
+    }
+#endif
+    return string_search_detail::find_in_set(haystack, characters, pos, true);
+}
+
+[[nodiscard]] constexpr std::size_t find_first_not_of(
+    const std::string_view haystack,
+    [[maybe_unused]] const std::size_t readable_length,
+    const std::string_view characters,
+    const std::size_t pos)
+{
+    if (std::is_constant_evaluated() || characters.empty())
+    {
+        return haystack.find_first_not_of(characters, pos);
+    }
+#if defined(FIXED_CONTAINERS_STRING_SEARCH_SSE2)
+    if (characters.size() <= string_search_detail::MAXIMUM_VECTORIZED_SET_SIZE)
+    {
+        return string_search_detail::find_in_small_set(
+            haystack, readable_length, characters, pos, false);
+    }
+#endif
+    return string_search_detail::find_in_set(haystack, characters, pos, false);
+}
+}  // namespace fixed_containers::string_search
+
+#undef FIXED_CONTAINERS_STRING_SEARCH_SSE2
@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <limits>
 
 namespace fixed_containers::circular_indexing
 {
@@ -68,4 +69,44 @@ TEST(CyclesAndInteger, DecrementIndexWithWraparound)
     }
 }
 
+namespace
+{
+// Checks the compile-time capacity functions against the range-based ones, for every index and
+// for steps up to a few cycles
+template <std::size_t CAPACITY>
+constexpr bool matches_range_based_wraparound()
+{
+    constexpr IntegerRange RANGE = IntegerRange::closed_open(0, CAPACITY);
+    for (std::size_t index = 0; index < CAPACITY; index++)
+    {
+        for (std::size_t n = 0; n <= 3 * CAPACITY; n++)
+        {
+            if (increment_index_with_wraparound<CAPACITY>(index, n) !=
+                    increment_index_with_wraparound(RANGE, index, n).integer ||
+                decrement_index_with_wraparound<CAPACITY>(index, n) !=
+                    decrement_index_with_wraparound(RANGE, index, n).integer)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TEST(CircularIndexing, CompileTimeCapacity)
+{
+    static_assert(matches_range_based_wraparound<1>());
+    static_assert(matches_range_based_wraparound<7>());
+    static_assert(matches_range_based_wraparound<8>());
+    static_assert(matches_range_based_wraparound<12>());
+    static_assert(matches_range_based_wraparound<16>());
+
+    static_assert(0 == wrap_index<0>(5));
+    static_assert(0 == increment_index_with_wraparound<0>(0, 3));
+    static_assert(5 == wrap_index<8>(21));
+    static_assert(3 == wrap_index<7>(24));
+    static_assert(1 == wrap_index<7>((std::numeric_limits<std::size_t>::max)()));
+}
+
 }  // namespace fixed_containers::circular_indexing
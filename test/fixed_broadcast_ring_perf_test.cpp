@@ -0,0 +1,115 @@
+#include "fixed_containers/fixed_broadcast_ring.hpp"
+#include "fixed_containers/fixed_circular_deque.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1'024;
+
+struct Sample
+{
+    std::uint64_t timestamp;
+    std::array<double, 3> values;
+};
+
+// The baseline: a FixedCircularDeque guarded by a mutex, which readers hold while copying
+template <typename T, std::size_t MAXIMUM_SIZE>
+class MutexGuardedRing
+{
+    mutable std::mutex mutex_{};
+    FixedCircularDeque<T, MAXIMUM_SIZE> deque_{};
+    std::size_t published_count_{0};
+
+public:
+    struct Cursor
+    {
+        std::size_t next_position{0};
+    };
+
+    void publish(const T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        deque_.push_back(value);
+        published_count_++;
+    }
+
+    std::optional<T> try_read(Cursor& cursor) const
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        const std::size_t oldest_position = published_count_ - deque_.size();
+        cursor.next_position = (std::max)(cursor.next_position, oldest_position);
+        if (cursor.next_position == published_count_)
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{deque_[cursor.next_position - oldest_position]};
+        cursor.next_position++;
+        return out;
+    }
+};
+
+// Publish rate of the writer while `state.range(0)` readers tail the ring
+template <typename RingType>
+void benchmark_ring_publish(benchmark::State& state)
+{
+    const auto ring = std::make_unique<RingType>();
+    const auto reader_count = static_cast<std::size_t>(state.range(0));
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers{};
+    for (std::size_t i = 0; i < reader_count; i++)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                typename RingType::Cursor cursor{};
+                while (!done.load(std::memory_order_relaxed))
+                {
+                    const std::optional<Sample> sample = ring->try_read(cursor);
+                    benchmark::DoNotOptimize(sample);
+                    if (!sample.has_value())
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    Sample sample{};
+    for (auto _ : state)
+    {
+        sample.timestamp++;
+        ring->publish(sample);
+    }
+
+    done.store(true, std::memory_order_relaxed);
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using MutexRing = MutexGuardedRing<Sample, CAPACITY>;
+using BroadcastRing = FixedBroadcastRing<Sample, CAPACITY>;
+
+BENCHMARK(benchmark_ring_publish<MutexRing>)->DenseRange(0, 4)->UseRealTime();
+BENCHMARK(benchmark_ring_publish<BroadcastRing>)->DenseRange(0, 4)->UseRealTime();
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
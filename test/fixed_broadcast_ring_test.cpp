@@ -0,0 +1,199 @@
+#include "fixed_containers/fixed_broadcast_ring.hpp"
+
+#include "fixed_containers/cache_line.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using BroadcastRingType = FixedBroadcastRing<int, 5>;
+static_assert(!std::is_copy_constructible_v<BroadcastRingType>);
+static_assert(!std::is_move_constructible_v<BroadcastRingType>);
+static_assert(alignof(BroadcastRingType) == CACHE_LINE_SIZE);
+static_assert(BroadcastRingType::static_max_size() == 5);
+static_assert(std::is_trivially_copyable_v<BroadcastRingType::Cursor>);
+
+// Not a multiple of the word size, to exercise the partial last word
+struct Sample
+{
+    std::uint32_t id;
+    std::uint16_t x;
+    std::uint16_t y;
+    std::uint32_t z;
+
+    constexpr bool operator==(const Sample& other) const = default;
+};
+static_assert(sizeof(Sample) == 12);
+
+// Carries its own checksum, so that readers can tell if they were handed a torn copy
+struct CheckedMessage
+{
+    std::uint64_t value;
+    std::array<std::uint64_t, 3> payload;
+    std::uint64_t check;
+
+    static constexpr CheckedMessage make(const std::uint64_t value)
+    {
+        return {value, {value, value * 3, value * 7}, ~value};
+    }
+    [[nodiscard]] constexpr bool is_intact() const { return *this == make(value); }
+
+    constexpr bool operator==(const CheckedMessage& other) const = default;
+};
+}  // namespace
+
+TEST(FixedBroadcastRing, DefaultConstructor)
+{
+    const FixedBroadcastRing<int, 8> var1{};
+    EXPECT_EQ(8, var1.max_size());
+    EXPECT_EQ(0, var1.published_count());
+
+    FixedBroadcastRing<int, 8>::Cursor cursor{};
+    EXPECT_EQ(std::nullopt, var1.try_read(cursor));
+    EXPECT_EQ(0, cursor.position());
+    EXPECT_EQ(0, cursor.missed_count());
+}
+
+TEST(FixedBroadcastRing, EveryReaderSeesEveryElement)
+{
+    FixedBroadcastRing<Sample, 3> var1{};
+    FixedBroadcastRing<Sample, 3>::Cursor cursor1{};
+    FixedBroadcastRing<Sample, 3>::Cursor cursor2{};
+
+    var1.publish({1, 2, 3, 4});
+    var1.publish({5, 6, 7, 8});
+    EXPECT_EQ(2, var1.published_count());
+
+    EXPECT_EQ((Sample{1, 2, 3, 4}), var1.try_read(cursor1));
+    EXPECT_EQ((Sample{5, 6, 7, 8}), var1.try_read(cursor1));
+    EXPECT_EQ(std::nullopt, var1.try_read(cursor1));
+
+    // The second reader is independent of the first one
+    EXPECT_EQ((Sample{1, 2, 3, 4}), var1.try_read(cursor2));
+
+    var1.publish({9, 10, 11, 12});
+    EXPECT_EQ((Sample{9, 10, 11, 12}), var1.try_read(cursor1));
+    EXPECT_EQ((Sample{5, 6, 7, 8}), var1.try_read(cursor2));
+    EXPECT_EQ((Sample{9, 10, 11, 12}), var1.try_read(cursor2));
+    EXPECT_EQ(3, cursor1.position());
+    EXPECT_EQ(3, cursor2.position());
+    EXPECT_EQ(0, cursor1.missed_count());
+    EXPECT_EQ(0, cursor2.missed_count());
+}
+
+TEST(FixedBroadcastRing, LappedReaderSkipsAhead)
+{
+    FixedBroadcastRing<int, 4> var1{};
+    FixedBroadcastRing<int, 4>::Cursor cursor{};
+
+    for (int i = 0; i < 3; i++)
+    {
+        var1.publish(i);
+    }
+    EXPECT_EQ(0, var1.try_read(cursor));
+
+    // Overwrites 0 to 5, while the reader is at 1
+    for (int i = 3; i < 10; i++)
+    {
+        var1.publish(i);
+    }
+    EXPECT_EQ(6, var1.try_read(cursor));
+    EXPECT_EQ(5, cursor.missed_count());
+    EXPECT_EQ(7, var1.try_read(cursor));
+    EXPECT_EQ(8, var1.try_read(cursor));
+    EXPECT_EQ(9, var1.try_read(cursor));
+    EXPECT_EQ(std::nullopt, var1.try_read(cursor));
+    EXPECT_EQ(10, cursor.position());
+    EXPECT_EQ(5, cursor.missed_count());
+}
+
+TEST(FixedBroadcastRing, MakeCursor)
+{
+    FixedBroadcastRing<int, 4> var1{};
+    var1.publish(0);
+    var1.publish(1);
+
+    FixedBroadcastRing<int, 4>::Cursor cursor = var1.make_cursor();
+    EXPECT_EQ(2, cursor.position());
+    EXPECT_EQ(std::nullopt, var1.try_read(cursor));
+
+    var1.publish(2);
+    EXPECT_EQ(2, var1.try_read(cursor));
+    EXPECT_EQ(0, cursor.missed_count());
+}
+
+TEST(FixedBroadcastRing, WriterAndReaderThreads)
+{
+    static constexpr std::uint64_t ELEMENT_COUNT = 100'000;
+    static constexpr std::size_t READER_COUNT = 3;
+    // Small, so that readers get lapped
+    FixedBroadcastRing<CheckedMessage, 16> var1{};
+
+    struct ReaderResult
+    {
+        std::uint64_t read_count{0};
+        std::uint64_t missed_count{0};
+        bool in_order{true};
+        bool intact{true};
+    };
+    std::array<ReaderResult, READER_COUNT> results{};
+
+    std::vector<std::thread> readers{};
+    for (std::size_t i = 0; i < READER_COUNT; i++)
+    {
+        readers.emplace_back(
+            [&var1, &result = results.at(i)]()
+            {
+                FixedBroadcastRing<CheckedMessage, 16>::Cursor cursor{};
+                std::optional<std::uint64_t> previous{};
+                while (cursor.position() < ELEMENT_COUNT)
+                {
+                    const std::optional<CheckedMessage> message = var1.try_read(cursor);
+                    if (!message.has_value())
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    result.read_count++;
+                    result.intact = result.intact && message->is_intact();
+                    result.in_order = result.in_order && message->value + 1 == cursor.position() &&
+                                      (!previous.has_value() || *previous < message->value);
+                    previous = message->value;
+                }
+                result.missed_count = cursor.missed_count();
+            });
+    }
+
+    for (std::uint64_t i = 0; i < ELEMENT_COUNT; i++)
+    {
+        var1.publish(CheckedMessage::make(i));
+        if (i % 64 == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(ELEMENT_COUNT, var1.published_count());
+    for (const ReaderResult& result : results)
+    {
+        EXPECT_TRUE(result.intact);
+        EXPECT_TRUE(result.in_order);
+        EXPECT_EQ(ELEMENT_COUNT, result.read_count + result.missed_count);
+    }
+}
+
+}  // namespace fixed_containers
@@ -624,6 +624,71 @@ TEST(FixedCircularDeque, PopFrontEmpty)
     run_test(FixedCircularDequeInitialStateLastIndex{});
 }
 
+TEST(FixedCircularDeque, PopFrontNAndAsSpans)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 11>({0, 1, 2, 3});
+            var.pop_front_n(2);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array{2, 3}));
+        static_assert(VAL1.as_spans()[0].size() + VAL1.as_spans()[1].size() == 2);
+
+        auto var2 = Factory::template create<int, 3>({10, 11, 12});
+        var2.push_back(13);
+        const auto [first, second] = var2.as_spans();
+        std::deque<int> joined{first.begin(), first.end()};
+        joined.insert(joined.end(), second.begin(), second.end());
+        EXPECT_TRUE(std::ranges::equal(joined, std::array{11, 12, 13}));
+        EXPECT_DEATH(var2.pop_front_n(4), "");
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
+TEST(FixedCircularDeque, PushBackRange)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 4>({0, 1, 2});
+            const std::array<int, 3> entries{3, 4, 5};
+            var.push_back_range(entries.begin(), entries.end());
+            return var;
+        }();
+        static_assert(std::ranges::equal(VAL1, std::array{2, 3, 4, 5}));
+
+        // Only the last 4 incoming elements are kept
+        constexpr auto VAL2 = []()
+        {
+            auto var = Factory::template create<int, 4>({0, 1});
+            const std::array<int, 7> entries{2, 3, 4, 5, 6, 7, 8};
+            var.push_back_range(entries.begin(), entries.end());
+            return var;
+        }();
+        static_assert(std::ranges::equal(VAL2, std::array{5, 6, 7, 8}));
+
+        auto var3 = Factory::template create<MockNonTrivialInt, 3>({10, 11});
+        const std::array<MockNonTrivialInt, 2> entries{12, 13};
+        var3.push_back_range(entries.begin(), entries.end());
+        EXPECT_TRUE(std::ranges::equal(var3, std::array<MockNonTrivialInt, 3>{11, 12, 13}));
+
+        auto var4 = Factory::template create<int, 3>({10});
+        MockIntegralStream<int> stream{4};
+        var4.push_back_range(stream.begin(), stream.end());
+        EXPECT_TRUE(std::ranges::equal(var4, std::array{3, 2, 1}));
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
 TEST(FixedCircularDeque, BracketOperator)
 {
     auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
@@ -6,7 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -201,6 +203,43 @@ TEST(FixedCircularQueue, Pop)
     static_assert(VAL1.size() == 1);
 }
 
+TEST(FixedCircularQueue, DrainThroughSpans)
+{
+    FixedCircularQueue<int, 4> var1{};
+    for (int i = 0; i < 6; i++)
+    {
+        var1.push(i);
+    }
+
+    // The oldest element is in the middle of the storage, so the elements come in two segments
+    const auto [first, second] = std::as_const(var1).as_spans();
+    EXPECT_TRUE(std::ranges::equal(first, std::array{2, 3}));
+    EXPECT_TRUE(std::ranges::equal(second, std::array{4, 5}));
+
+    var1.pop_n(first.size());
+    EXPECT_EQ(4, var1.front());
+    EXPECT_EQ(2, var1.size());
+    EXPECT_DEATH(var1.pop_n(3), "");
+    var1.pop_n(2);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedCircularQueue, PushRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedCircularQueue<int, 3> var{};
+        var.push(0);
+        const std::array<int, 4> entries{1, 2, 3, 4};
+        var.push_range(entries.begin(), entries.end());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.front() == 2);
+    static_assert(VAL1.back() == 4);
+}
+
 TEST(FixedCircularQueue, Equality)
 {
     static constexpr std::array<int, 2> ENTRY_A1{1, 2};
@@ -0,0 +1,235 @@
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// The simplest possible ring buffer, as a lower bound: power-of-two capacity, masked indices
+template <typename T, std::size_t CAPACITY>
+class RawRingBuffer
+{
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0);
+
+    std::array<T, CAPACITY> data_{};
+    std::size_t head_{};
+    std::size_t size_{};
+
+public:
+    using value_type = T;
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+    const T& operator[](const std::size_t index) const
+    {
+        return data_[(head_ + index) & (CAPACITY - 1)];
+    }
+    void push_back(const T& value)
+    {
+        data_[(head_ + size_) & (CAPACITY - 1)] = value;
+        size_++;
+    }
+    void pop_front()
+    {
+        head_ = (head_ + 1) & (CAPACITY - 1);
+        size_--;
+    }
+};
+
+constexpr std::size_t POWER_OF_TWO_CAPACITY = 1'024;
+constexpr std::size_t OTHER_CAPACITY = 1'000;
+
+// A full deque whose front is in the middle of the storage, so that accesses wrap around
+template <typename DequeType, std::size_t CAPACITY>
+std::unique_ptr<DequeType> make_wrapped_around_deque()
+{
+    auto instance = std::make_unique<DequeType>();
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance->push_back(static_cast<std::uint32_t>(i));
+    }
+    for (std::size_t i = 0; i < CAPACITY / 2; i++)
+    {
+        instance->pop_front();
+        instance->push_back(static_cast<std::uint32_t>(i));
+    }
+    return instance;
+}
+
+template <typename DequeType, std::size_t CAPACITY>
+void benchmark_deque_iteration(benchmark::State& state)
+{
+    const auto instance = make_wrapped_around_deque<DequeType, CAPACITY>();
+
+    for (auto _ : state)
+    {
+        std::uint32_t sum = 0;
+        for (const std::uint32_t entry : *instance)
+        {
+            sum += entry;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template <typename DequeType, std::size_t CAPACITY>
+void benchmark_deque_random_access(benchmark::State& state)
+{
+    const auto instance = make_wrapped_around_deque<DequeType, CAPACITY>();
+
+    for (auto _ : state)
+    {
+        std::uint32_t sum = 0;
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < CAPACITY; i++)
+        {
+            // Odd strides visit every index, in a scattered order
+            index += 389;
+            index = index >= CAPACITY ? index - CAPACITY : index;
+            sum += (*instance)[index];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Refills a wrapped-around deque with a batch and drains it, as a producer/consumer pair would
+void benchmark_deque_batch_transfer_elementwise(benchmark::State& state)
+{
+    using DequeType = FixedDeque<std::uint32_t, OTHER_CAPACITY>;
+    auto instance = make_wrapped_around_deque<DequeType, OTHER_CAPACITY>();
+    std::array<std::uint32_t, OTHER_CAPACITY> batch{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < OTHER_CAPACITY; i++)
+        {
+            batch[i] = instance->front();
+            instance->pop_front();
+        }
+        for (const std::uint32_t entry : batch)
+        {
+            instance->push_back(entry);
+        }
+        benchmark::DoNotOptimize(instance->back());
+    }
+}
+
+void benchmark_deque_batch_transfer_segmented(benchmark::State& state)
+{
+    using DequeType = FixedDeque<std::uint32_t, OTHER_CAPACITY>;
+    auto instance = make_wrapped_around_deque<DequeType, OTHER_CAPACITY>();
+    std::array<std::uint32_t, OTHER_CAPACITY> batch{};
+
+    for (auto _ : state)
+    {
+        auto write_it = batch.begin();
+        for (const std::span<const std::uint32_t> segment : std::as_const(*instance).as_spans())
+        {
+            write_it = std::copy(segment.begin(), segment.end(), write_it);
+        }
+        instance->pop_front_n(instance->size());
+        instance->push_back_range(batch.begin(), batch.end());
+        benchmark::DoNotOptimize(instance->back());
+    }
+}
+
+constexpr std::size_t WINDOW_CAPACITY = 4'096;
+constexpr std::size_t INGESTED_BATCH_SIZE = 10'000;
+
+// Ingests a batch that is larger than a sliding window, which keeps only the newest elements
+void benchmark_circular_deque_ingest_elementwise(benchmark::State& state)
+{
+    using DequeType = FixedCircularDeque<std::uint32_t, WINDOW_CAPACITY>;
+    auto instance = make_wrapped_around_deque<DequeType, WINDOW_CAPACITY>();
+    const std::vector<std::uint32_t> batch(INGESTED_BATCH_SIZE, 7);
+
+    for (auto _ : state)
+    {
+        for (const std::uint32_t entry : batch)
+        {
+            instance->push_back(entry);
+        }
+        benchmark::DoNotOptimize(instance->back());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(INGESTED_BATCH_SIZE));
+}
+
+void benchmark_circular_deque_ingest_range(benchmark::State& state)
+{
+    using DequeType = FixedCircularDeque<std::uint32_t, WINDOW_CAPACITY>;
+    auto instance = make_wrapped_around_deque<DequeType, WINDOW_CAPACITY>();
+    const std::vector<std::uint32_t> batch(INGESTED_BATCH_SIZE, 7);
+
+    for (auto _ : state)
+    {
+        // Alternate between a batch that replaces the whole window and one that only evicts part
+        instance->push_back_range(batch.begin(), batch.end());
+        instance->push_back_range(batch.begin(), std::next(batch.begin(), WINDOW_CAPACITY / 2));
+        benchmark::DoNotOptimize(instance->back());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(INGESTED_BATCH_SIZE + (WINDOW_CAPACITY / 2)));
+}
+
+// An order queue: cancels erase at uniformly spread positions, new orders join at the back
+template <typename DequeType, std::size_t CAPACITY>
+void benchmark_deque_erase_and_insert_in_the_middle(benchmark::State& state)
+{
+    auto instance = make_wrapped_around_deque<DequeType, CAPACITY>();
+    instance->pop_back();
+    std::uint64_t random_state = 88172645463325252ULL;
+
+    for (auto _ : state)
+    {
+        // xorshift
+        random_state ^= random_state << 13U;
+        random_state ^= random_state >> 7U;
+        random_state ^= random_state << 17U;
+        const auto position = static_cast<std::ptrdiff_t>(random_state % instance->size());
+        instance->erase(std::next(instance->cbegin(), position));
+        instance->insert(std::next(instance->cbegin(), position / 2),
+                         static_cast<std::uint32_t>(position));
+        benchmark::DoNotOptimize(instance->front());
+    }
+}
+
+BENCHMARK(benchmark_deque_iteration<std::deque<std::uint32_t>, POWER_OF_TWO_CAPACITY>);
+BENCHMARK(benchmark_deque_iteration<FixedDeque<std::uint32_t, POWER_OF_TWO_CAPACITY>,
+                                    POWER_OF_TWO_CAPACITY>);
+BENCHMARK(benchmark_deque_iteration<FixedDeque<std::uint32_t, OTHER_CAPACITY>, OTHER_CAPACITY>);
+
+BENCHMARK(benchmark_deque_random_access<std::deque<std::uint32_t>, POWER_OF_TWO_CAPACITY>);
+BENCHMARK(benchmark_deque_random_access<RawRingBuffer<std::uint32_t, POWER_OF_TWO_CAPACITY>,
+                                        POWER_OF_TWO_CAPACITY>);
+BENCHMARK(benchmark_deque_random_access<FixedDeque<std::uint32_t, POWER_OF_TWO_CAPACITY>,
+                                        POWER_OF_TWO_CAPACITY>);
+BENCHMARK(
+    benchmark_deque_random_access<FixedDeque<std::uint32_t, OTHER_CAPACITY>, OTHER_CAPACITY>);
+
+BENCHMARK(benchmark_deque_erase_and_insert_in_the_middle<std::deque<std::uint32_t>,
+                                                         POWER_OF_TWO_CAPACITY>);
+BENCHMARK(benchmark_deque_erase_and_insert_in_the_middle<
+          FixedDeque<std::uint32_t, POWER_OF_TWO_CAPACITY>,
+          POWER_OF_TWO_CAPACITY>);
+
+BENCHMARK(benchmark_deque_batch_transfer_elementwise);
+BENCHMARK(benchmark_deque_batch_transfer_segmented);
+
+BENCHMARK(benchmark_circular_deque_ingest_elementwise);
+BENCHMARK(benchmark_circular_deque_ingest_range);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
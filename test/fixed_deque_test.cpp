@@ -18,6 +18,7 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -578,6 +579,107 @@ TEST(FixedDeque, PopFrontEmpty)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, PopFrontN)
+{
+    auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 11>({0, 1, 2, 3, 4});
+            var.pop_front_n(3);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array{3, 4}));
+
+        auto var2 = Factory::template create<MockNonTrivialInt, 7>({10, 11, 12});
+        var2.pop_front_n(0);
+        EXPECT_EQ(3, var2.size());
+        var2.pop_front_n(3);
+        EXPECT_TRUE(var2.empty());
+        EXPECT_DEATH(var2.pop_front_n(1), "");
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateLastIndex{});
+}
+
+TEST(FixedDeque, PushBackRange)
+{
+    auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 11>({0, 1});
+            const std::array<int, 3> entries{2, 3, 4};
+            var.push_back_range(entries.begin(), entries.end());
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3, 4}));
+
+        auto var2 = Factory::template create<MockNonTrivialInt, 5>({10});
+        const std::array<MockNonTrivialInt, 3> entries{11, 12, 13};
+        var2.push_back_range(entries.begin(), entries.end());
+        EXPECT_TRUE(std::ranges::equal(var2, std::array<MockNonTrivialInt, 4>{10, 11, 12, 13}));
+        var2.push_back_range(entries.begin(), entries.begin());
+        EXPECT_EQ(4, var2.size());
+        EXPECT_DEATH(var2.push_back_range(entries.begin(), entries.end()), "");
+
+        MockIntegralStream<int> stream{3};
+        auto var3 = Factory::template create<int, 5>({0});
+        var3.push_back_range(stream.begin(), stream.end());
+        EXPECT_TRUE(std::ranges::equal(var3, std::array{0, 3, 2, 1}));
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateLastIndex{});
+}
+
+TEST(FixedDeque, AsSpans)
+{
+    auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = Factory::template create<int, 11>({0, 1, 2, 3});
+        static_assert(VAL1.as_spans()[0].size() + VAL1.as_spans()[1].size() == 4);
+        static_assert(VAL1.as_spans()[0].front() == 0);
+
+        auto var2 = Factory::template create<int, 5>({0, 1, 2});
+        const auto [first, second] = var2.as_spans();
+        std::deque<int> joined{first.begin(), first.end()};
+        joined.insert(joined.end(), second.begin(), second.end());
+        EXPECT_TRUE(std::ranges::equal(var2, joined));
+
+        // Writes through the spans are visible in the deque
+        for (const std::span<int> segment : var2.as_spans())
+        {
+            for (int& entry : segment)
+            {
+                entry *= 10;
+            }
+        }
+        EXPECT_TRUE(std::ranges::equal(var2, std::array{0, 10, 20}));
+
+        var2.clear();
+        EXPECT_TRUE(std::as_const(var2).as_spans()[0].empty());
+        EXPECT_TRUE(std::as_const(var2).as_spans()[1].empty());
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateLastIndex{});
+
+    {
+        // Capacity 4, front at index 2: the elements wrap around to the beginning of the storage
+        FixedDeque<int, 4> var1{0, 1, 2, 3};
+        var1.pop_front_n(2);
+        const std::array<int, 2> entries{4, 5};
+        var1.push_back_range(entries.begin(), entries.end());
+        const auto [first, second] = var1.as_spans();
+        EXPECT_TRUE(std::ranges::equal(first, std::array{2, 3}));
+        EXPECT_TRUE(std::ranges::equal(second, std::array{4, 5}));
+    }
+}
+
 TEST(FixedDeque, BracketOperator)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
@@ -1171,6 +1273,66 @@ TEST(FixedDeque, IteratorRegressionConsistencyWhenTheStartingIndexIsChanged)
     }
 }
 
+namespace
+{
+// Rotates the contents through every starting position, moving iterators in steps of every size
+template <std::size_t CAPACITY>
+void expect_consistent_iterators_at_every_starting_position()
+{
+    FixedDeque<int, CAPACITY> var{};
+    std::deque<int> reference{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        var.push_back(static_cast<int>(i));
+        reference.push_back(static_cast<int>(i));
+    }
+
+    for (std::size_t rotation = 0; rotation < 2 * CAPACITY; rotation++)
+    {
+        ASSERT_TRUE(std::equal(var.begin(), var.end(), reference.begin(), reference.end()));
+        ASSERT_TRUE(std::equal(var.rbegin(), var.rend(), reference.rbegin(), reference.rend()));
+        for (std::size_t step = 0; step < var.size(); step++)
+        {
+            const auto offset = static_cast<std::ptrdiff_t>(step);
+            auto iter = var.begin();
+            iter += offset;
+            ASSERT_EQ(reference[step], *iter);
+            ASSERT_EQ(reference[step], var[step]);
+            iter -= offset;
+            ASSERT_EQ(var.begin(), iter);
+            const auto distance_from_end = static_cast<std::ptrdiff_t>(var.size() - step);
+            ASSERT_EQ(reference[step], *std::prev(var.end(), distance_from_end));
+        }
+
+        // Alternate directions, so the start wraps both ways
+        if (rotation < CAPACITY)
+        {
+            const int front = var.front();
+            var.pop_front();
+            var.push_back(front);
+            reference.pop_front();
+            reference.push_back(front);
+        }
+        else
+        {
+            const int back = var.back();
+            var.pop_back();
+            var.push_front(back);
+            reference.pop_back();
+            reference.push_front(back);
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedDeque, IteratorsAtEveryStartingPosition)
+{
+    expect_consistent_iterators_at_every_starting_position<1>();
+    expect_consistent_iterators_at_every_starting_position<5>();
+    expect_consistent_iterators_at_every_starting_position<8>();
+    expect_consistent_iterators_at_every_starting_position<12>();
+}
+
 TEST(FixedDeque, Resize)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
@@ -2377,6 +2539,126 @@ INSTANTIATE_TYPED_TEST_SUITE_P(FixedDeque,
                                FixedDequeInstanceCheckTypes,
                                NameProviderForTypeParameterizedTest);
 
+TEST(FixedDeque, PopFrontNDestroysAcrossTheWrapAround)
+{
+    ASSERT_EQ(0, InstanceCounterNonTrivialAssignment::counter);
+    {
+        auto var1 =
+            FixedDequeInitialStateLastIndex::create<InstanceCounterNonTrivialAssignment, 5>();
+        for (int i = 0; i < 4; i++)
+        {
+            var1.emplace_back(i);
+        }
+        ASSERT_EQ(4, InstanceCounterNonTrivialAssignment::counter);
+
+        // The first element is at the end of the storage, the next two wrapped around
+        var1.pop_front_n(3);
+        EXPECT_EQ(1, InstanceCounterNonTrivialAssignment::counter);
+        EXPECT_EQ(3, var1.front().get());
+    }
+    EXPECT_EQ(0, InstanceCounterNonTrivialAssignment::counter);
+}
+
+namespace
+{
+// Inserts and erases two elements at every position of a deque of 6, for every placement of the
+// front in the storage, so that both sides get moved, with and without crossing the wrap-around
+template <typename T>
+constexpr bool mid_insert_and_erase_match_std_deque()
+{
+    constexpr std::size_t CAPACITY = 9;
+    constexpr std::size_t INITIAL_SIZE = 6;
+    const auto value_of = [](const T& entry)
+    {
+        if constexpr (std::same_as<T, int>)
+        {
+            return entry;
+        }
+        else
+        {
+            return entry.get();
+        }
+    };
+    const auto matches = [&](const FixedDeque<T, CAPACITY>& deque, const std::deque<int>& expected)
+    {
+        return std::ranges::equal(deque, expected, {}, value_of);
+    };
+
+    for (std::size_t front = 0; front < CAPACITY; front++)
+    {
+        for (std::size_t pos = 0; pos <= INITIAL_SIZE; pos++)
+        {
+            FixedDeque<T, CAPACITY> var1{};
+            set_deque_initial_state(var1, STARTING_OFFSET_OF_TEST + front);
+            std::deque<int> expected{};
+            for (int i = 0; i < static_cast<int>(INITIAL_SIZE); i++)
+            {
+                var1.push_back(T{i});
+                expected.push_back(i);
+            }
+
+            const auto offset = static_cast<std::ptrdiff_t>(pos);
+            const std::array<T, 2> incoming{T{10}, T{11}};
+            auto inserted_it = var1.insert(
+                std::next(var1.cbegin(), offset), incoming.begin(), incoming.end());
+            expected.insert(std::next(expected.begin(), offset), {10, 11});
+            if (!matches(var1, expected) || inserted_it != std::next(var1.begin(), offset))
+            {
+                return false;
+            }
+
+            auto emplaced_it = var1.emplace(std::next(var1.cbegin(), offset + 1), 12);
+            expected.insert(std::next(expected.begin(), offset + 1), 12);
+            if (!matches(var1, expected) || value_of(*emplaced_it) != 12)
+            {
+                return false;
+            }
+
+            const auto first = std::next(var1.cbegin(), offset);
+            auto erased_it = var1.erase(first, std::next(first, 3));
+            expected.erase(std::next(expected.begin(), offset),
+                           std::next(expected.begin(), offset + 3));
+            if (!matches(var1, expected) || erased_it != std::next(var1.begin(), offset))
+            {
+                return false;
+            }
+
+            if (pos < INITIAL_SIZE)
+            {
+                var1.erase(std::next(var1.cbegin(), offset));
+                expected.erase(std::next(expected.begin(), offset));
+                if (!matches(var1, expected))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TEST(FixedDeque, MidInsertAndEraseMoveTheShorterSide)
+{
+    EXPECT_TRUE(mid_insert_and_erase_match_std_deque<int>());
+
+    ASSERT_EQ(0, InstanceCounterNonTrivialAssignment::counter);
+    EXPECT_TRUE(mid_insert_and_erase_match_std_deque<InstanceCounterNonTrivialAssignment>());
+    EXPECT_EQ(0, InstanceCounterNonTrivialAssignment::counter);
+
+    // Near the front, only the elements before the position move
+    constexpr auto VAL1 = []()
+    {
+        FixedDeque<int, 8> var{0, 1, 2, 3, 4, 5};
+        var.insert(std::next(var.cbegin()), 9);
+        var.erase(std::next(var.cbegin(), 2));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 9, 2, 3, 4, 5}));
+    static_assert(VAL1.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.start ==
+                  STARTING_OFFSET_OF_TEST);
+}
+
 }  // namespace fixed_containers
 
 namespace another_namespace_unrelated_to_the_fixed_containers_namespace
@@ -9,6 +9,8 @@
 #include <cstddef>
 #include <functional>
 #include <map>
+#include <memory>
+#include <string>
 #include <type_traits>
 
 namespace fixed_containers
@@ -83,6 +85,78 @@ void benchmark_map_lookup(benchmark::State& state)
 
 BENCHMARK(benchmark_map_lookup<std::map<int, int>>);
 BENCHMARK(benchmark_map_lookup<FixedMap<int, int, 200>>);
+
+// Equivalent to `std::less<int>`, but opaque to the tree, so lookups take the generic path
+struct OpaqueLess
+{
+    constexpr bool operator()(const int& lhs, const int& rhs) const { return lhs < rhs; }
+};
+
+constexpr std::size_t LOOKUP_MAP_SIZE = 4'096;
+
+// Even keys are present and odd keys are not, so `key_offset` selects hits (0) or misses (1).
+// Lookups are in a scattered order, to defeat branch prediction along the search path.
+template <typename MapType>
+void benchmark_map_lookup_scattered(benchmark::State& state, const std::size_t key_offset)
+{
+    using KeyType = typename MapType::key_type;
+    auto instance = std::make_unique<MapType>();
+    for (std::size_t i = 0; i < LOOKUP_MAP_SIZE; i++)
+    {
+        instance->try_emplace(static_cast<KeyType>(2 * ((i * 2'731) % LOOKUP_MAP_SIZE)));
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        i = (i + 2'731) % LOOKUP_MAP_SIZE;
+        auto it = instance->find(static_cast<KeyType>((2 * i) + key_offset));
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+template <typename MapType>
+void benchmark_map_lookup_hit(benchmark::State& state)
+{
+    benchmark_map_lookup_scattered<MapType>(state, 0);
+}
+template <typename MapType>
+void benchmark_map_lookup_miss(benchmark::State& state)
+{
+    benchmark_map_lookup_scattered<MapType>(state, 1);
+}
+
+BENCHMARK(benchmark_map_lookup_hit<std::map<int, int>>);
+BENCHMARK(benchmark_map_lookup_hit<FixedMap<int, int, LOOKUP_MAP_SIZE>>);
+BENCHMARK(benchmark_map_lookup_hit<FixedMap<int, int, LOOKUP_MAP_SIZE, OpaqueLess>>);
+BENCHMARK(benchmark_map_lookup_miss<std::map<int, int>>);
+BENCHMARK(benchmark_map_lookup_miss<FixedMap<int, int, LOOKUP_MAP_SIZE>>);
+BENCHMARK(benchmark_map_lookup_miss<FixedMap<int, int, LOOKUP_MAP_SIZE, OpaqueLess>>);
+
+template <typename MapType>
+void benchmark_map_copy_non_trivially_copyable(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    // Large maps do not fit comfortably on the stack
+    auto instance = std::make_unique<MapType>();
+    for (std::size_t i = 0; i < 10'000; i++)
+    {
+        // Scatter the nodes, as real-world insertion orders do
+        const std::size_t key = (i * 7919) % 10'000;
+        instance->try_emplace(static_cast<KeyType>(key), std::to_string(key));
+    }
+
+    for (auto _ : state)
+    {
+        auto copy = std::make_unique<MapType>(*instance);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+BENCHMARK(benchmark_map_copy_non_trivially_copyable<std::map<int, std::string>>);
+BENCHMARK(benchmark_map_copy_non_trivially_copyable<FixedMap<int, std::string, 10'000>>);
+BENCHMARK(benchmark_map_copy_non_trivially_copyable<
+          CompactContiguousFixedMap<int, std::string, 10'000>>);
 }  // namespace
 }  // namespace fixed_containers
 
@@ -8,6 +8,8 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -1242,6 +1244,61 @@ TEST(FixedMap, FindTransparentComparator)
     static_assert(VAL.find(KEY_B) == VAL.end());
 }
 
+TEST(FixedMap, FindArithmeticKeys)
+{
+    // `std::less` over arithmetic keys takes a specialized lookup path. Check it against a
+    // comparator that the tree can not see through.
+    struct OpaqueLess
+    {
+        constexpr bool operator()(const int& lhs, const int& rhs) const { return lhs < rhs; }
+    };
+
+    FixedMap<int, int, 50> fast{};
+    FixedMap<int, int, 50, std::less<>> fast_transparent{};
+    FixedMap<int, int, 50, OpaqueLess> generic{};
+    for (int i = 0; i < 50; i++)
+    {
+        const int key = 2 * ((i * 17) % 50);
+        fast.try_emplace(key, i);
+        fast_transparent.try_emplace(key, i);
+        generic.try_emplace(key, i);
+    }
+
+    for (int key = -1; key <= 101; key++)
+    {
+        EXPECT_EQ(generic.contains(key), fast.contains(key));
+        EXPECT_EQ(generic.contains(key), fast_transparent.contains(key));
+        EXPECT_EQ(std::distance(generic.begin(), generic.lower_bound(key)),
+                  std::distance(fast.begin(), fast.lower_bound(key)));
+        EXPECT_EQ(std::distance(generic.begin(), generic.upper_bound(key)),
+                  std::distance(fast_transparent.begin(), fast_transparent.upper_bound(key)));
+    }
+
+    constexpr FixedMap<double, int, 10> VAL1{{-2.5, 1}, {0.0, 2}, {4.25, 3}};
+    static_assert(VAL1.contains(-2.5));
+    static_assert(VAL1.contains(-0.0));
+    static_assert(!VAL1.contains(4.0));
+    static_assert(VAL1.lower_bound(4.0)->second == 3);
+    static_assert(VAL1.upper_bound(-2.5)->second == 2);
+}
+
+TEST(FixedMap, SpecializedStdLess)
+{
+    // The default comparator must go through the specialization, not `<=>`
+    constexpr FixedMap<MockLessSpecializedInt, int, 10> VAL1{{{1}, 10}, {{3}, 30}, {{2}, 20}};
+    static_assert(VAL1.begin()->first.value == 3);
+    static_assert(std::prev(VAL1.end())->first.value == 1);
+    static_assert(VAL1.contains({2}));
+    static_assert(!VAL1.contains({4}));
+    static_assert(VAL1.at({1}) == 10);
+    static_assert(VAL1.lower_bound({2})->second == 20);
+    static_assert(VAL1.upper_bound({2})->second == 10);
+
+    std::array<int, 3> keys{};
+    std::ranges::transform(VAL1, keys.begin(), [](const auto& entry) { return entry.first.value; });
+    EXPECT_EQ((std::array<int, 3>{3, 2, 1}), keys);
+}
+
 TEST(FixedMap, MutableFind)
 {
     constexpr auto VAL1 = []()
@@ -1372,6 +1429,255 @@ TEST(FixedMap, EqualRangeTransparentComparator)
     static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
 }
 
+namespace
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+using OrderStatisticFixedMap =
+    FixedMap<K,
+             V,
+             MAXIMUM_SIZE,
+             std::less<K>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+static_assert(TriviallyCopyable<OrderStatisticFixedMap<int, int, 10>>);
+static_assert(IsStructuralType<OrderStatisticFixedMap<int, int, 10>>);
+}  // namespace
+
+TEST(FixedMap, Nth)
+{
+    constexpr OrderStatisticFixedMap<int, int, 10> VAL1{{2, 20}, {4, 40}, {6, 60}};
+    static_assert(VAL1.nth(0)->first == 2);
+    static_assert(VAL1.nth(1)->first == 4);
+    static_assert(VAL1.nth(2)->first == 6);
+    static_assert(VAL1.nth(3) == VAL1.cend());
+
+    OrderStatisticFixedMap<int, int, 10> var1{{2, 20}, {4, 40}, {6, 60}};
+    var1.nth(1)->second = 41;
+    ASSERT_EQ(41, var1.at(4));
+    var1.erase(2);
+    ASSERT_EQ(4, var1.nth(0)->first);
+    var1[5] = 50;
+    ASSERT_EQ(5, var1.nth(1)->first);
+    ASSERT_EQ(var1.end(), var1.nth(3));
+}
+
+TEST(FixedMap, IndexOf)
+{
+    constexpr OrderStatisticFixedMap<int, int, 10> VAL1{{2, 20}, {4, 40}, {6, 60}};
+    static_assert(VAL1.index_of(VAL1.cbegin()) == 0);
+    static_assert(VAL1.index_of(VAL1.find(4)) == 1);
+    static_assert(VAL1.index_of(VAL1.find(6)) == 2);
+    static_assert(VAL1.index_of(VAL1.cend()) == 3);
+
+    // Random-access-like advance in O(log n)
+    static_assert(VAL1.nth(VAL1.index_of(VAL1.cbegin()) + 2) == std::next(VAL1.cbegin(), 2));
+}
+
+TEST(FixedMap, Rank)
+{
+    constexpr OrderStatisticFixedMap<int, int, 10> VAL1{{2, 20}, {4, 40}, {6, 60}};
+    static_assert(VAL1.rank(1) == 0);
+    static_assert(VAL1.rank(2) == 0);
+    static_assert(VAL1.rank(3) == 1);
+    static_assert(VAL1.rank(4) == 1);
+    static_assert(VAL1.rank(6) == 2);
+    static_assert(VAL1.rank(7) == 3);
+
+    OrderStatisticFixedMap<int, int, 100> var1{};
+    for (int i = 99; i >= 0; i--)
+    {
+        var1[i * 2] = i;
+    }
+    erase_if(var1, [](const auto& entry) { return entry.second % 3 == 0; });
+    std::size_t expected_rank = 0;
+    for (int key = 0; key < 200; key++)
+    {
+        ASSERT_EQ(expected_rank, var1.rank(key));
+        if (var1.contains(key))
+        {
+            ASSERT_EQ(key, var1.nth(expected_rank)->first);
+            expected_rank++;
+        }
+    }
+    ASSERT_EQ(var1.size(), expected_rank);
+}
+
+TEST(FixedMap, SetOperations)
+{
+    constexpr FixedMap<int, int, 10> VAL1{{1, 10}, {3, 30}, {5, 50}};
+    constexpr FixedMap<int, int, 10> VAL2{{3, 300}, {4, 400}};
+
+    static_assert(set_union(VAL1, VAL2) ==
+                  FixedMap<int, int, 10>{{1, 10}, {3, 30}, {4, 400}, {5, 50}});
+    static_assert(set_union(VAL2, VAL1) ==
+                  FixedMap<int, int, 10>{{1, 10}, {3, 300}, {4, 400}, {5, 50}});
+    static_assert(set_intersection(VAL1, VAL2) == FixedMap<int, int, 10>{{3, 30}});
+    static_assert(set_difference(VAL1, VAL2) == FixedMap<int, int, 10>{{1, 10}, {5, 50}});
+
+    const FixedMap<int, std::string, 10> var1{{1, "a"}, {2, "b"}};
+    const FixedMap<int, std::string, 10> var2{{2, "x"}, {3, "c"}};
+    FixedMap<int, std::string, 10> var3 = set_union(var1, var2);
+    ASSERT_EQ(3, var3.size());
+    ASSERT_EQ("b", var3.at(2));
+    var3[0] = "z";
+    ASSERT_EQ(4, var3.size());
+    ASSERT_EQ("z", var3.begin()->second);
+}
+
+TEST(FixedMap, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{{1, 10}, {3, 30}};
+        FixedMap<int, int, 10> other{{2, 200}, {3, 300}};
+        var.merge(other);
+        return std::pair{var, other};
+    }();
+
+    static_assert(VAL1.first == FixedMap<int, int, 10>{{1, 10}, {2, 200}, {3, 30}});
+    static_assert(VAL1.second == FixedMap<int, int, 10>{{3, 300}});
+
+    FixedMap<int, MockMoveableButNotCopyable, 10> var1{};
+    var1.try_emplace(1);
+    var1.try_emplace(3);
+    FixedMap<int, MockMoveableButNotCopyable, 10> var2{};
+    var2.try_emplace(2);
+    var2.try_emplace(3);
+    var1.merge(var2);
+    ASSERT_EQ(3, var1.size());
+    ASSERT_EQ(1, var2.size());
+    ASSERT_TRUE(var2.contains(3));
+
+    FixedMap<int, int, 2> var4{{1, 10}};
+    FixedMap<int, int, 2> var5{{2, 20}, {3, 30}};
+    EXPECT_DEATH(var4.merge(var5), "");
+}
+
+TEST(FixedMap, Split)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{{1, 10}, {2, 20}, {3, 30}};
+        FixedMap<int, int, 10> upper = var.split(2);
+        return std::pair{var, upper};
+    }();
+
+    static_assert(VAL1.first == FixedMap<int, int, 10>{{1, 10}});
+    static_assert(VAL1.second == FixedMap<int, int, 10>{{2, 20}, {3, 30}});
+
+    OrderStatisticFixedMap<int, std::string, 20> var1{};
+    for (int i = 0; i < 20; i++)
+    {
+        var1[i] = std::to_string(i);
+    }
+    OrderStatisticFixedMap<int, std::string, 20> var2 = var1.split(15);
+    ASSERT_EQ(15, var1.size());
+    ASSERT_EQ(5, var2.size());
+    ASSERT_EQ("14", var1.nth(14)->second);
+    ASSERT_EQ("17", var2.nth(2)->second);
+    ASSERT_EQ(2, var2.rank(17));
+}
+
+TEST(FixedMap, MergeAndSplitWithContiguousStorage)
+{
+    // Erasing from contiguous storage moves another node into the freed index, while the trees
+    // are being rebuilt in place
+    using FixedMapType =
+        FixedMap<int,
+                 std::string,
+                 64,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedContiguousStorage>;
+
+    const auto same_entries = [](const auto& expected, const FixedMapType& actual)
+    {
+        return std::ranges::equal(expected,
+                                  actual,
+                                  [](const auto& lhs, const auto& rhs)
+                                  { return lhs.first == rhs.first && lhs.second == rhs.second; });
+    };
+
+    FixedMapType var1{};
+    FixedMapType var2{};
+    std::map<int, std::string> expected1{};
+    std::map<int, std::string> expected2{};
+    for (int i = 0; i < 30; i++)
+    {
+        const int key1 = (i * 7) % 40;
+        const int key2 = (i * 11) % 45;
+        var1.try_emplace(key1, std::to_string(key1));
+        expected1.try_emplace(key1, std::to_string(key1));
+        var2.try_emplace(key2, std::to_string(-key2));
+        expected2.try_emplace(key2, std::to_string(-key2));
+    }
+
+    var1.merge(var2);
+    expected1.merge(expected2);
+    ASSERT_TRUE(same_entries(expected1, var1));
+    ASSERT_TRUE(same_entries(expected2, var2));
+
+    FixedMapType var3 = var1.split(20);
+    const auto expected3 = std::map<int, std::string>{expected1.lower_bound(20), expected1.end()};
+    expected1.erase(expected1.lower_bound(20), expected1.end());
+    ASSERT_TRUE(same_entries(expected1, var1));
+    ASSERT_TRUE(same_entries(expected3, var3));
+
+    // The rebuilt trees keep working
+    for (int i = 0; i < 40; i += 3)
+    {
+        ASSERT_EQ(expected1.erase(i), var1.erase(i));
+        ASSERT_EQ(expected2.insert_or_assign(i, "x").second, var2.insert_or_assign(i, "x").second);
+    }
+    ASSERT_TRUE(same_entries(expected1, var1));
+    ASSERT_TRUE(same_entries(expected2, var2));
+}
+
+TEST(FixedMap, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        for (int i = 9; i >= 0; i--)
+        {
+            var[i] = i;
+        }
+        erase_if(var, [](const auto& entry) { return entry.first % 3 == 0; });
+        var.compact();
+        var[100] = 100;
+        return var;
+    }();
+
+    static_assert(VAL1 == FixedMap<int, int, 10>{
+                              {1, 1}, {2, 2}, {4, 4}, {5, 5}, {7, 7}, {8, 8}, {100, 100}});
+
+    FixedMap<int, std::string, 20> var1{};
+    for (int i = 0; i < 20; i++)
+    {
+        var1[(i * 7) % 20] = std::to_string((i * 7) % 20);
+    }
+    erase_if(var1, [](const auto& entry) { return entry.first % 2 == 0; });
+    var1.compact();
+    ASSERT_EQ(10, var1.size());
+    int expected_key = 1;
+    for (const auto& [key, value] : var1)
+    {
+        ASSERT_EQ(expected_key, key);
+        ASSERT_EQ(std::to_string(key), value);
+        expected_key += 2;
+    }
+    // Entries are now laid out in iteration order
+    const std::string* previous_value = nullptr;
+    for (const auto& [key, value] : var1)
+    {
+        ASSERT_TRUE(previous_value == nullptr ||
+                    std::less<const std::string*>{}(previous_value, std::addressof(value)));
+        previous_value = std::addressof(value);
+    }
+}
+
 TEST(FixedMap, Equality)
 {
     {
@@ -1577,6 +1883,117 @@ TEST(FixedMap, ComplexNontrivialCopies)
     map_1.clear();
 }
 
+TEST(FixedMap, NontrivialCopiesPreserveLayout)
+{
+    FixedMap<int, std::string, 30, std::greater<int>> map_1{};
+    for (int i = 0; i < 30; i++)
+    {
+        map_1.try_emplace((i * 7) % 30, std::to_string((i * 7) % 30));
+    }
+    erase_if(map_1, [](const auto& entry) { return entry.first % 4 == 0; });
+
+    const FixedMap<int, std::string, 30, std::greater<int>> map_2{map_1};
+    ASSERT_EQ(map_1, map_2);
+    ASSERT_EQ(29, map_2.begin()->first);
+
+    // The nodes of the copy are at the same indices as in the original, including the freelist
+    auto it_1 = map_1.begin();
+    for (auto it_2 = map_2.begin(); it_2 != map_2.end(); ++it_1, ++it_2)
+    {
+        ASSERT_EQ(std::addressof(it_1->second) - std::addressof(map_1.begin()->second),
+                  std::addressof(it_2->second) - std::addressof(map_2.begin()->second));
+    }
+
+    map_1.begin()->second = "modified";
+    ASSERT_EQ("29", map_2.begin()->second);
+
+    FixedMap<int, std::string, 30, std::greater<int>> map_3{};
+    map_3[100] = "100";
+    map_3 = map_2;
+    ASSERT_EQ(map_2, map_3);
+    while (map_3.size() < 30)
+    {
+        map_3[static_cast<int>(map_3.size()) + 100] = "new";
+    }
+    ASSERT_EQ(30, map_3.size());
+
+    FixedMap<int, std::string, 30, std::greater<int>> map_4{std::move(map_3)};
+    ASSERT_EQ(30, map_4.size());
+    ASSERT_EQ("29", map_4.at(29));
+}
+
+namespace
+{
+// Orders ascending or descending, depending on its state
+struct DirectionalLess
+{
+    bool descending{false};
+
+    bool operator()(const std::string& lhs, const std::string& rhs) const
+    {
+        return descending ? rhs < lhs : lhs < rhs;
+    }
+};
+}  // namespace
+
+TEST(FixedMap, NontrivialAssignmentsCopyTheComparator)
+{
+    using MapType = FixedMap<std::string, int, 16, DirectionalLess>;
+    MapType descending{DirectionalLess{.descending = true}};
+    for (int i = 0; i < 8; i++)
+    {
+        descending.try_emplace(std::to_string(i), i);
+    }
+
+    MapType map_1{};
+    map_1.try_emplace("x", 1);
+    map_1 = descending;
+    ASSERT_TRUE(map_1.key_comp().descending);
+    ASSERT_EQ("7", map_1.begin()->first);
+    for (int i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(map_1.contains(std::to_string(i)));
+    }
+
+    MapType map_2{};
+    map_2.try_emplace("x", 1);
+    map_2 = std::move(map_1);
+    ASSERT_TRUE(map_2.key_comp().descending);
+    for (int i = 0; i < 8; i++)
+    {
+        ASSERT_EQ(i, map_2.at(std::to_string(i)));
+    }
+    map_2.try_emplace("8", 8);
+    ASSERT_EQ("8", map_2.begin()->first);
+}
+
+TEST(FixedMap, NontrivialConstructionWithNonAssignableComparator)
+{
+    // Copy and move construction only need to copy-construct the comparator
+    struct FixedDirectionLess
+    {
+        const bool descending;
+
+        bool operator()(const std::string& lhs, const std::string& rhs) const
+        {
+            return descending ? rhs < lhs : lhs < rhs;
+        }
+    };
+    static_assert(!std::is_copy_assignable_v<FixedDirectionLess>);
+
+    using MapType = FixedMap<std::string, int, 16, FixedDirectionLess>;
+    MapType map_1{FixedDirectionLess{.descending = true}};
+    map_1.try_emplace("1", 1);
+    map_1.try_emplace("2", 2);
+
+    const MapType map_2{map_1};
+    ASSERT_EQ("2", map_2.begin()->first);
+    MapType map_3{std::move(map_1)};
+    ASSERT_EQ("2", map_3.begin()->first);
+    map_3.try_emplace("3", 3);
+    ASSERT_EQ("3", map_3.begin()->first);
+}
+
 TEST(FixedUnorderedMap, ComplexNontrivialMoves)
 {
     using FM = FixedMap<int, MockMoveableButNotCopyable, 30>;
@@ -0,0 +1,121 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+#include "fixed_containers/fixed_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1'024;
+constexpr std::uint64_t MESSAGE_COUNT = 1 << 16;
+
+// The baseline: a FixedQueue guarded by a mutex
+template <typename T, std::size_t MAXIMUM_SIZE>
+class MutexGuardedQueue
+{
+    std::mutex mutex_{};
+    FixedQueue<T, MAXIMUM_SIZE> queue_{};
+
+public:
+    bool try_push(const T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (is_full(queue_))
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+
+    std::optional<T> try_pop()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (queue_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{queue_.front()};
+        queue_.pop();
+        return out;
+    }
+};
+
+// `state.range(0)` producers and as many consumers move `MESSAGE_COUNT` messages in total.
+// Waiting yields, so that the benchmark also makes progress with more threads than cores.
+template <typename QueueType>
+void benchmark_queue_producers_and_consumers(benchmark::State& state)
+{
+    const auto thread_count = static_cast<std::uint64_t>(state.range(0));
+    const std::uint64_t messages_per_thread = MESSAGE_COUNT / thread_count;
+    const auto queue = std::make_unique<QueueType>();
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads{};
+        for (std::uint64_t i = 0; i < thread_count; i++)
+        {
+            threads.emplace_back(
+                [&queue, messages_per_thread]()
+                {
+                    for (std::uint64_t value = 0; value < messages_per_thread; value++)
+                    {
+                        while (!queue->try_push(value))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            threads.emplace_back(
+                [&queue, messages_per_thread]()
+                {
+                    for (std::uint64_t i = 0; i < messages_per_thread; i++)
+                    {
+                        std::optional<std::uint64_t> value = queue->try_pop();
+                        while (!value.has_value())
+                        {
+                            std::this_thread::yield();
+                            value = queue->try_pop();
+                        }
+                        benchmark::DoNotOptimize(value);
+                    }
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(messages_per_thread * thread_count));
+}
+
+using MutexQueue = MutexGuardedQueue<std::uint64_t, CAPACITY>;
+using MpmcQueue = FixedMpmcQueue<std::uint64_t, CAPACITY>;
+using DenseMpmcQueue = FixedMpmcQueue<std::uint64_t, CAPACITY, 1>;
+
+BENCHMARK(benchmark_queue_producers_and_consumers<MutexQueue>)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK(benchmark_queue_producers_and_consumers<MpmcQueue>)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK(benchmark_queue_producers_and_consumers<DenseMpmcQueue>)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,188 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using MpmcQueueType = FixedMpmcQueue<int, 5>;
+static_assert(StandardLayout<MpmcQueueType>);
+static_assert(!std::is_copy_constructible_v<MpmcQueueType>);
+static_assert(!std::is_move_constructible_v<MpmcQueueType>);
+static_assert(MpmcQueueType::static_max_size() == 5);
+
+// Slots are on separate cache lines by default, and can be packed instead
+static_assert(sizeof(fixed_mpmc_queue_detail::Slot<int, CACHE_LINE_SIZE>) == CACHE_LINE_SIZE);
+static_assert(sizeof(fixed_mpmc_queue_detail::Slot<int, 1>) == 2 * sizeof(std::size_t));
+static_assert(sizeof(FixedMpmcQueue<int, 64, 1>) < sizeof(FixedMpmcQueue<int, 64>));
+
+struct FixedMpmcQueueInstanceCounterUniquenessToken
+{
+};
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedMpmcQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedMpmcQueue, DefaultConstructor)
+{
+    const FixedMpmcQueue<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(8, var1.max_size());
+}
+
+TEST(FixedMpmcQueue, TryPushAndTryPop)
+{
+    // A capacity that is not a power of two, so that the positions wrap around with a division
+    FixedMpmcQueue<int, 3, 1> var1{};
+    for (int round = 0; round < 4; round++)
+    {
+        EXPECT_TRUE(var1.try_push(round));
+        const int value = round + 1;
+        EXPECT_TRUE(var1.try_push(value));
+        EXPECT_TRUE(var1.try_emplace(round + 2));
+        EXPECT_FALSE(var1.try_push(99));
+        EXPECT_EQ(3, var1.size());
+
+        EXPECT_EQ(round, var1.try_pop());
+        EXPECT_EQ(round + 1, var1.try_pop());
+        EXPECT_EQ(round + 2, var1.pop());
+        EXPECT_EQ(std::nullopt, var1.try_pop());
+        EXPECT_TRUE(var1.empty());
+    }
+}
+
+TEST(FixedMpmcQueue, CapacityOne)
+{
+    FixedMpmcQueue<int, 1> var1{};
+    for (int round = 0; round < 3; round++)
+    {
+        EXPECT_TRUE(var1.try_push(round));
+        EXPECT_FALSE(var1.try_push(99));
+        EXPECT_EQ(1, var1.size());
+        EXPECT_EQ(round, var1.try_pop());
+        EXPECT_EQ(std::nullopt, var1.try_pop());
+        EXPECT_TRUE(var1.empty());
+    }
+
+    // Every element hands the single slot back and forth between the threads
+    std::thread producer{[&var1]()
+                         {
+                             for (int i = 0; i < 100; i++)
+                             {
+                                 var1.push(i);
+                             }
+                         }};
+    int sum = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        sum += var1.pop();
+    }
+    producer.join();
+    EXPECT_EQ(4'950, sum);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedMpmcQueue, NonTriviallyDestructible)
+{
+    using T = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, T::counter);
+    {
+        FixedMpmcQueue<T, 4> var1{};
+        var1.push(T{1});
+        var1.emplace(2);
+        EXPECT_EQ(2, T::counter);
+
+        std::optional<T> popped = var1.try_pop();
+        ASSERT_TRUE(popped.has_value());
+        EXPECT_EQ(1, popped->get());
+        EXPECT_EQ(2, T::counter);
+    }
+    // The destructor destroys the element that was never popped
+    EXPECT_EQ(0, T::counter);
+}
+
+TEST(FixedMpmcQueue, BlockingPushAndPop)
+{
+    FixedMpmcQueue<int, 2> var1{};
+
+    // Blocks on the full queue until the main thread pops
+    std::thread producer{[&var1]()
+                         {
+                             for (int i = 0; i < 100; i++)
+                             {
+                                 var1.push(i);
+                             }
+                         }};
+
+    int sum = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        sum += var1.pop();
+    }
+    producer.join();
+
+    EXPECT_EQ(4'950, sum);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedMpmcQueue, ManyProducersAndConsumers)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::uint64_t ELEMENT_COUNT_PER_PRODUCER = 20'000;
+    FixedMpmcQueue<std::uint64_t, 64, 1> var1{};
+
+    std::vector<std::thread> threads{};
+    std::atomic<std::uint64_t> popped_sum{0};
+    for (std::size_t i = 0; i < THREAD_COUNT; i++)
+    {
+        threads.emplace_back(
+            [&var1]()
+            {
+                for (std::uint64_t value = 1; value <= ELEMENT_COUNT_PER_PRODUCER; value++)
+                {
+                    // Mix non-blocking and blocking pushes
+                    if (value % 2 == 0 || !var1.try_push(value))
+                    {
+                        var1.push(value);
+                    }
+                }
+            });
+        threads.emplace_back(
+            [&var1, &popped_sum]()
+            {
+                std::uint64_t sum = 0;
+                for (std::uint64_t i = 0; i < ELEMENT_COUNT_PER_PRODUCER; i++)
+                {
+                    sum += var1.pop();
+                }
+                popped_sum.fetch_add(sum, std::memory_order_relaxed);
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::uint64_t sum_per_producer =
+        ELEMENT_COUNT_PER_PRODUCER * (ELEMENT_COUNT_PER_PRODUCER + 1) / 2;
+    EXPECT_EQ(THREAD_COUNT * sum_per_producer, popped_sum.load());
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
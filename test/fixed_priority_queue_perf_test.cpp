@@ -0,0 +1,157 @@
+#include "fixed_containers/fixed_priority_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// A key with some satellite data, as in event queues
+struct Event
+{
+    std::uint64_t time;
+    std::array<std::uint64_t, 3> payload;
+
+    constexpr bool operator<(const Event& other) const { return time < other.time; }
+};
+
+constexpr std::size_t CAPACITY = 4'096;
+
+template <typename T>
+T make_value(const std::size_t index)
+{
+    // A deterministic shuffle of [0, CAPACITY)
+    const auto key = static_cast<std::uint64_t>((index * 2'654'435'761U) % CAPACITY);
+    if constexpr (std::is_same_v<T, Event>)
+    {
+        return Event{key, {}};
+    }
+    else
+    {
+        return static_cast<T>(key);
+    }
+}
+
+template <typename T>
+std::vector<T> make_values()
+{
+    std::vector<T> values{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        values.push_back(make_value<T>(i));
+    }
+    return values;
+}
+
+template <typename QueueType>
+std::unique_ptr<QueueType> make_empty_queue()
+{
+    using T = typename QueueType::value_type;
+    if constexpr (requires { typename QueueType::container_type::allocator_type; })
+    {
+        std::vector<T> storage{};
+        storage.reserve(CAPACITY);
+        return std::make_unique<QueueType>(std::less<T>{}, std::move(storage));
+    }
+    else
+    {
+        return std::make_unique<QueueType>();
+    }
+}
+
+// Fills the queue, then drains it
+template <typename QueueType>
+void benchmark_priority_queue_push_pop(benchmark::State& state)
+{
+    using T = typename QueueType::value_type;
+    const std::vector<T> values = make_values<T>();
+    auto instance = make_empty_queue<QueueType>();
+
+    for (auto _ : state)
+    {
+        for (const T& value : values)
+        {
+            instance->push(value);
+        }
+        while (!instance->empty())
+        {
+            benchmark::DoNotOptimize(instance->top());
+            instance->pop();
+        }
+    }
+}
+
+// Replaces the top of a full queue with a later value, as a simulation loop does
+template <typename QueueType>
+void benchmark_priority_queue_steady_state(benchmark::State& state)
+{
+    using T = typename QueueType::value_type;
+    const std::vector<T> values = make_values<T>();
+    auto instance = make_empty_queue<QueueType>();
+    for (std::size_t i = 0; i + 1 < CAPACITY; i++)
+    {
+        instance->push(values[i]);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        T value = instance->top();
+        instance->pop();
+        instance->push(values[i++ % CAPACITY]);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template <typename QueueType>
+void benchmark_priority_queue_construct_from_range(benchmark::State& state)
+{
+    using T = typename QueueType::value_type;
+    const std::vector<T> values = make_values<T>();
+
+    for (auto _ : state)
+    {
+        auto instance = std::make_unique<QueueType>(values.begin(), values.end());
+        benchmark::DoNotOptimize(instance->top());
+    }
+}
+
+template <typename T>
+using StdPriorityQueue = std::priority_queue<T>;
+template <typename T>
+using FixedBinaryPriorityQueue = FixedPriorityQueue<T, CAPACITY, std::less<T>, 2>;
+template <typename T>
+using FixedQuaternaryPriorityQueue = FixedPriorityQueue<T, CAPACITY, std::less<T>, 4>;
+
+BENCHMARK(benchmark_priority_queue_push_pop<StdPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_push_pop<FixedBinaryPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_push_pop<FixedQuaternaryPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_push_pop<StdPriorityQueue<Event>>);
+BENCHMARK(benchmark_priority_queue_push_pop<FixedBinaryPriorityQueue<Event>>);
+BENCHMARK(benchmark_priority_queue_push_pop<FixedQuaternaryPriorityQueue<Event>>);
+
+BENCHMARK(benchmark_priority_queue_steady_state<StdPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_steady_state<FixedBinaryPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_steady_state<FixedQuaternaryPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_steady_state<StdPriorityQueue<Event>>);
+BENCHMARK(benchmark_priority_queue_steady_state<FixedBinaryPriorityQueue<Event>>);
+BENCHMARK(benchmark_priority_queue_steady_state<FixedQuaternaryPriorityQueue<Event>>);
+
+BENCHMARK(benchmark_priority_queue_construct_from_range<StdPriorityQueue<std::uint32_t>>);
+BENCHMARK(benchmark_priority_queue_construct_from_range<FixedBinaryPriorityQueue<std::uint32_t>>);
+BENCHMARK(
+    benchmark_priority_queue_construct_from_range<FixedQuaternaryPriorityQueue<std::uint32_t>>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
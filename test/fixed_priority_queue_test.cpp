@@ -0,0 +1,280 @@
+#include "fixed_containers/fixed_priority_queue.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace fixed_containers
+{
+using PriorityQueueType = FixedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<PriorityQueueType>);
+static_assert(NotTrivial<PriorityQueueType>);
+static_assert(StandardLayout<PriorityQueueType>);
+static_assert(IsStructuralType<PriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<PriorityQueueType>);
+
+using IndexedPriorityQueueType = FixedIndexedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<IndexedPriorityQueueType>);
+static_assert(IsStructuralType<IndexedPriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<IndexedPriorityQueueType>);
+
+namespace
+{
+// A deterministic sequence with repeated values, in no particular order
+constexpr int value_at(const std::size_t index) { return static_cast<int>((index * 37) % 101); }
+
+template <std::size_t ARITY, class Compare>
+void expect_same_order_as_std_priority_queue()
+{
+    constexpr std::size_t CAPACITY = 200;
+    FixedPriorityQueue<int, CAPACITY, Compare, ARITY> var1{};
+    std::priority_queue<int, std::vector<int>, Compare> reference{};
+
+    // Interleave pushes and pops, with the queue growing overall
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        var1.push(value_at(i));
+        reference.push(value_at(i));
+        if (i % 3 == 0)
+        {
+            ASSERT_EQ(reference.top(), var1.top());
+            var1.pop();
+            reference.pop();
+        }
+    }
+    ASSERT_EQ(reference.size(), var1.size());
+    while (!reference.empty())
+    {
+        ASSERT_EQ(reference.top(), var1.top());
+        var1.pop();
+        reference.pop();
+    }
+    ASSERT_TRUE(var1.empty());
+}
+}  // namespace
+
+TEST(FixedPriorityQueue, DefaultConstructor)
+{
+    constexpr FixedPriorityQueue<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+}
+
+TEST(FixedPriorityQueue, IteratorConstructor)
+{
+    constexpr auto VAL1 = []()
+    {
+        const std::array<int, 6> values{3, 9, 1, 7, 9, 4};
+        return FixedPriorityQueue<int, 8>{values.begin(), values.end()};
+    }();
+    static_assert(VAL1.size() == 6);
+    static_assert(VAL1.top() == 9);
+
+    std::vector<int> values{};
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        values.push_back(value_at(i));
+    }
+    FixedPriorityQueue<int, 100, std::greater<>, 3> var1{values.begin(), values.end()};
+    std::priority_queue<int, std::vector<int>, std::greater<>> reference{values.begin(),
+                                                                         values.end()};
+    while (!reference.empty())
+    {
+        ASSERT_EQ(reference.top(), var1.top());
+        var1.pop();
+        reference.pop();
+    }
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedPriorityQueue, MaxSize)
+{
+    constexpr FixedPriorityQueue<int, 3> VAL1{};
+    static_assert(VAL1.max_size() == 3);
+    static_assert(FixedPriorityQueue<int, 3>::static_max_size() == 3);
+    static_assert(max_size_v<FixedPriorityQueue<int, 3>> == 3);
+}
+
+TEST(FixedPriorityQueue, PushPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedPriorityQueue<int, 4> var{};
+        var.push(2);
+        var.push(5);
+        var.emplace(3);
+        var.push(1);
+        var.pop();
+        return var;
+    }();
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.top() == 3);
+    static_assert(!is_full(VAL1));
+
+    FixedPriorityQueue<int, 2> var1{};
+    var1.push(1);
+    var1.push(2);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.push(3), "");
+    var1.clear();
+    EXPECT_DEATH(var1.pop(), "");
+    EXPECT_DEATH((void)var1.top(), "");
+}
+
+TEST(FixedPriorityQueue, SameOrderAsStdPriorityQueue)
+{
+    expect_same_order_as_std_priority_queue<2, std::less<>>();
+    expect_same_order_as_std_priority_queue<3, std::less<>>();
+    expect_same_order_as_std_priority_queue<4, std::less<>>();
+    expect_same_order_as_std_priority_queue<4, std::greater<>>();
+    expect_same_order_as_std_priority_queue<8, std::greater<>>();
+}
+
+TEST(FixedPriorityQueue, MoveOnlyElements)
+{
+    const auto compare = [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs)
+    { return *lhs < *rhs; };
+    FixedPriorityQueue<std::unique_ptr<int>, 8, decltype(compare)> var1{compare};
+    for (const int value : {4, 8, 1, 6})
+    {
+        var1.push(std::make_unique<int>(value));
+    }
+    EXPECT_EQ(8, *var1.top());
+    var1.pop();
+    EXPECT_EQ(6, *var1.top());
+    var1.pop();
+    EXPECT_EQ(4, *var1.top());
+}
+
+TEST(FixedIndexedPriorityQueue, PushPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 4> var{};
+        var.push(2);
+        var.push(5);
+        var.emplace(3);
+        var.pop();
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.top() == 3);
+
+    FixedIndexedPriorityQueue<int, 2> var1{};
+    var1.push(1);
+    var1.push(2);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.push(3), "");
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_DEATH(var1.pop(), "");
+}
+
+TEST(FixedIndexedPriorityQueue, Handles)
+{
+    FixedIndexedPriorityQueue<int, 4> var1{};
+    const auto handle_a = var1.push(10);
+    const auto handle_b = var1.push(30);
+    const auto handle_c = var1.push(20);
+
+    EXPECT_EQ(handle_b, var1.top_handle());
+    EXPECT_EQ(10, var1.at(handle_a));
+    EXPECT_EQ(20, var1.at(handle_c));
+
+    var1.pop();
+    EXPECT_FALSE(var1.contains(handle_b));
+    EXPECT_TRUE(var1.contains(handle_a));
+    EXPECT_DEATH((void)var1.at(handle_b), "");
+
+    // Released handles are reused
+    const auto handle_d = var1.push(5);
+    EXPECT_EQ(handle_b, handle_d);
+    EXPECT_EQ(5, var1.at(handle_d));
+
+    var1.erase(handle_c);
+    EXPECT_FALSE(var1.contains(handle_c));
+    EXPECT_EQ(2, var1.size());
+    EXPECT_EQ(handle_a, var1.top_handle());
+    EXPECT_DEATH(var1.erase(handle_c), "");
+}
+
+TEST(FixedIndexedPriorityQueue, DecreaseKey)
+{
+    // A min-heap, as in shortest-path searches
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 4, std::greater<>> var{};
+        var.push(10);
+        const auto handle = var.push(40);
+        var.push(20);
+        var.decrease_key(handle, 5);
+        return var;
+    }();
+    static_assert(VAL1.top() == 5);
+
+    FixedIndexedPriorityQueue<int, 4, std::greater<>> var1{};
+    const auto handle = var1.push(10);
+    var1.decrease_key(handle, 10);
+    EXPECT_EQ(10, var1.at(handle));
+    EXPECT_DEATH(var1.decrease_key(handle, 11), "");
+}
+
+TEST(FixedIndexedPriorityQueue, Update)
+{
+    constexpr std::size_t CAPACITY = 64;
+    FixedIndexedPriorityQueue<int, CAPACITY, std::less<>, 3> var1{};
+    std::array<FixedIndexedPriorityQueue<int, CAPACITY>::handle_type, CAPACITY> handles{};
+    std::array<int, CAPACITY> values{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        values.at(i) = value_at(i);
+        handles.at(i) = var1.push(values.at(i));
+    }
+
+    // Move every other element in either direction, and every fifth one out of the queue
+    for (std::size_t i = 0; i < CAPACITY; i += 2)
+    {
+        values.at(i) = value_at(i + 50);
+        var1.update(handles.at(i), values.at(i));
+    }
+    std::priority_queue<int> reference{};
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        if (i % 5 == 0)
+        {
+            var1.erase(handles.at(i));
+            continue;
+        }
+        reference.push(values.at(i));
+        EXPECT_EQ(values.at(i), var1.at(handles.at(i)));
+    }
+
+    while (!reference.empty())
+    {
+        ASSERT_EQ(reference.top(), var1.top());
+        ASSERT_EQ(reference.top(), var1.at(var1.top_handle()));
+        var1.pop();
+        reference.pop();
+    }
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
+
+namespace another_namespace_unrelated_to_the_fixed_containers_namespace
+{
+TEST(FixedPriorityQueue, ArgumentDependentLookup)
+{
+    // Compile-only test
+    fixed_containers::FixedPriorityQueue<int, 5> var1{};
+    (void)is_full(var1);
+}
+}  // namespace another_namespace_unrelated_to_the_fixed_containers_namespace
@@ -40,6 +40,16 @@ static_assert(IsStructuralType<DefaultRedBlackTreeNode<int, int>, 5, 99>);
 static_assert(IsStructuralType<CompactRedBlackTreeNode<int, EmptyValue>, 5>);
 static_assert(IsStructuralType<CompactRedBlackTreeNode<int, int>, 5, 99>);
 
+static_assert(IsRedBlackTreeNodeWithSubtreeSize<
+              SubtreeSizeAugmentedRedBlackTreeNode<CompactRedBlackTreeNode<int, int>>>);
+static_assert(IsRedBlackTreeNodeWithSubtreeSize<
+              SubtreeSizeAugmentedRedBlackTreeNode<DefaultRedBlackTreeNode<int, int>>>);
+static_assert(!IsRedBlackTreeNodeWithSubtreeSize<CompactRedBlackTreeNode<int, int>>);
+static_assert(IsStructuralType<
+              SubtreeSizeAugmentedRedBlackTreeNode<CompactRedBlackTreeNode<int, int>>,
+              5,
+              99>);
+
 static_assert(
     IsRedBlackTreeNodeWithValue<RedBlackTreeNodeView<CompactRedBlackTreeNode<int, EmptyValue>>>);
 
@@ -59,6 +69,17 @@ static_assert(TriviallyCopyAssignable<ES_1>);
 static_assert(TriviallyMoveAssignable<ES_1>);
 static_assert(IsStructuralType<ES_1>);
 
+using ES_2 = FixedRedBlackTree<int,
+                               int,
+                               10,
+                               std::less<int>,
+                               RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                               FixedIndexBasedPoolStorage,
+                               RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+static_assert(TriviallyCopyable<ES_2>);
+static_assert(IsStructuralType<ES_2>);
+static_assert(sizeof(ES_2) > sizeof(ES_1));
+
 template <typename K>
 constexpr CompactRedBlackTreeNode<K> make_node(const K& key,
                                                NodeIndex parent_index,
@@ -1872,4 +1893,378 @@ TEST(FixedRedBlackTree, TreeMaxHeight)
         }
     }
 }
+
+namespace
+{
+template <class TreeType>
+bool subtree_sizes_are_consistent(const TreeType& tree)
+{
+    std::size_t rank = 0;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        const auto node = tree.node_at(i);
+        const std::size_t left_size =
+            node.left_index() == NULL_INDEX ? 0 : tree.node_at(node.left_index()).subtree_size();
+        const std::size_t right_size =
+            node.right_index() == NULL_INDEX ? 0 : tree.node_at(node.right_index()).subtree_size();
+        if (node.subtree_size() != left_size + right_size + 1)
+        {
+            return false;
+        }
+        if (tree.rank_at(i) != rank || tree.index_of_nth_at(rank) != i)
+        {
+            return false;
+        }
+        rank++;
+    }
+
+    return rank == tree.size() && tree.rank_at(NULL_INDEX) == tree.size() &&
+           tree.index_of_nth_at(tree.size()) == NULL_INDEX;
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, SubtreeSizeAugmentation)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    FixedRedBlackTree<int,
+                      int,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedPoolStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        bst{};
+    ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+
+    std::array<int, MAXIMUM_SIZE> insertion_order{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        insertion_order[i] = static_cast<int>(i);
+    }
+    std::array<int, MAXIMUM_SIZE> deletion_order = insertion_order;
+
+    static constexpr std::size_t ITERATIONS = 10;
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    for (std::size_t iteration = 0; iteration < ITERATIONS; iteration++)
+    {
+        std::shuffle(insertion_order.begin(), insertion_order.end(), rng);
+        std::shuffle(deletion_order.begin(), deletion_order.end(), rng);
+        for (const int key : insertion_order)
+        {
+            bst[key] = key;
+            ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+        }
+
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            ASSERT_EQ(i, bst.node_at(bst.index_of_nth_at(i)).key());
+        }
+
+        for (const int key : deletion_order)
+        {
+            bst.delete_node(key);
+            ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+        }
+        ASSERT_TRUE(bst.empty());
+    }
+}
+
+TEST(FixedRedBlackTree, SubtreeSizeAugmentationContiguousStorage)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 32;
+    FixedRedBlackTree<int,
+                      int,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedContiguousStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        bst{};
+
+    std::array<int, MAXIMUM_SIZE> insertion_order{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        insertion_order[i] = static_cast<int>(i);
+    }
+
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    std::shuffle(insertion_order.begin(), insertion_order.end(), rng);
+    for (const int key : insertion_order)
+    {
+        bst[key] = key;
+        ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+    }
+
+    // Removing a range repositions nodes in contiguous storage
+    bst.delete_range_and_return_successor(bst.index_of_node_or_null(5),
+                                          bst.index_of_node_or_null(20));
+    ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+    ASSERT_EQ(MAXIMUM_SIZE - 15, bst.size());
+    ASSERT_EQ(4, bst.node_at(bst.index_of_nth_at(4)).key());
+    ASSERT_EQ(20, bst.node_at(bst.index_of_nth_at(5)).key());
+}
+
+namespace
+{
+template <class TreeType>
+bool satisfies_red_black_invariants(const TreeType& tree)
+{
+    if (tree.root_index() != NULL_INDEX && tree.node_at(tree.root_index()).color() != COLOR_BLACK)
+    {
+        return false;
+    }
+
+    std::size_t expected_black_height = 0;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        const auto node = tree.node_at(i);
+        const NodeIndex parent = node.parent_index();
+        if (node.color() == COLOR_RED && parent != NULL_INDEX &&
+            tree.node_at(parent).color() == COLOR_RED)
+        {
+            return false;
+        }
+        if (node.left_index() != NULL_INDEX && node.right_index() != NULL_INDEX)
+        {
+            continue;
+        }
+
+        // At least one null child, so this is the end of a root-to-leaf path
+        std::size_t black_height = 0;
+        for (NodeIndex j = i; j != NULL_INDEX; j = tree.node_at(j).parent_index())
+        {
+            black_height += static_cast<std::size_t>(tree.node_at(j).color() == COLOR_BLACK);
+        }
+        if (expected_black_height == 0)
+        {
+            expected_black_height = black_height;
+        }
+        if (black_height != expected_black_height)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, BalanceVine)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 70;
+    for (std::size_t size = 0; size < MAXIMUM_SIZE; size++)
+    {
+        FixedRedBlackTree<int,
+                          int,
+                          MAXIMUM_SIZE,
+                          std::less<int>,
+                          RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                          FixedIndexBasedPoolStorage,
+                          RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+            bst{};
+        NodeIndex vine_tail = NULL_INDEX;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            vine_tail = bst.append_to_vine(vine_tail, static_cast<int>(i), static_cast<int>(i));
+        }
+        bst.balance_vine();
+
+        ASSERT_EQ(size, bst.size());
+        ASSERT_TRUE(satisfies_red_black_invariants(bst));
+        ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+        ASSERT_LE(find_height(bst), static_cast<std::size_t>(std::log2(size + 1)));
+
+        // Still a regular tree afterwards
+        bst[-1] = -1;
+        bst.delete_node(static_cast<int>(size) - 1);
+        ASSERT_TRUE(satisfies_red_black_invariants(bst));
+        ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+        ASSERT_EQ(size, bst.size());
+    }
+}
+
+TEST(FixedRedBlackTree, BalanceVineContiguousStorage)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 33;
+    FixedRedBlackTree<int,
+                      EmptyValue,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedContiguousStorage>
+        bst{};
+    NodeIndex vine_tail = NULL_INDEX;
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        vine_tail = bst.append_to_vine(vine_tail, static_cast<int>(i * 2));
+    }
+    bst.balance_vine();
+
+    ASSERT_TRUE(satisfies_red_black_invariants(bst));
+    ASSERT_EQ(5, find_height(bst));
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        ASSERT_TRUE(bst.contains_node(static_cast<int>(i * 2)));
+        ASSERT_FALSE(bst.contains_node(static_cast<int>(i * 2 + 1)));
+    }
+}
+
+TEST(FixedRedBlackTree, Compact)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    FixedRedBlackTree<int,
+                      int,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedPoolStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        bst{};
+
+    std::array<int, MAXIMUM_SIZE> keys{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        keys[i] = static_cast<int>(i);
+    }
+
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    for (std::size_t kept = 0; kept <= MAXIMUM_SIZE; kept += 9)
+    {
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (const int key : keys)
+        {
+            bst[key] = key * 10;
+        }
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (std::size_t i = kept; i < MAXIMUM_SIZE; i++)
+        {
+            bst.delete_node(keys[i]);
+        }
+
+        bst.compact();
+        ASSERT_EQ(kept, bst.size());
+        ASSERT_TRUE(satisfies_red_black_invariants(bst));
+        ASSERT_TRUE(subtree_sizes_are_consistent(bst));
+        NodeIndex expected_index = 0;
+        int previous_key = -1;
+        for (NodeIndex i = bst.index_of_min_at(); i != NULL_INDEX;
+             i = bst.index_of_successor_at(i))
+        {
+            ASSERT_EQ(expected_index, i);
+            ASSERT_LT(previous_key, bst.node_at(i).key());
+            ASSERT_EQ(bst.node_at(i).key() * 10, bst.node_at(i).value());
+            previous_key = bst.node_at(i).key();
+            expected_index++;
+        }
+
+        // New nodes go right after the compacted ones
+        if (kept < MAXIMUM_SIZE)
+        {
+            NodeIndexAndParentIndex np_idxs = bst.index_of_node_with_parent(MAXIMUM_SIZE);
+            bst.insert_new_at(np_idxs, static_cast<int>(MAXIMUM_SIZE), 0);
+            ASSERT_EQ(kept, np_idxs.i);
+            ASSERT_TRUE(bst.delete_node(MAXIMUM_SIZE));
+        }
+        bst.clear();
+    }
+}
+
+TEST(FixedRedBlackTree, CompactContiguousStorage)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 16;
+    FixedRedBlackTree<int,
+                      EmptyValue,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedContiguousStorage>
+        bst{};
+    for (int key = 15; key >= 0; key--)
+    {
+        bst.insert_node(key);
+    }
+    bst.delete_node(3);
+    bst.delete_node(7);
+
+    bst.compact();
+    ASSERT_TRUE(satisfies_red_black_invariants(bst));
+    std::size_t expected_index = 0;
+    for (NodeIndex i = bst.index_of_min_at(); i != NULL_INDEX; i = bst.index_of_successor_at(i))
+    {
+        ASSERT_EQ(expected_index, i);
+        expected_index++;
+    }
+    ASSERT_EQ(14, expected_index);
+}
+
+namespace
+{
+template <template <class, std::size_t> typename StorageTemplate>
+void merge_and_split_in_place_test_helper()
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       MAXIMUM_SIZE,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+
+    const auto is_valid = [](const TreeType& tree, const int first_key, const int last_key)
+    {
+        std::size_t count = 0;
+        for (int key = first_key; key <= last_key; key++)
+        {
+            count += static_cast<std::size_t>(tree.contains_node(key));
+        }
+        return count == tree.size() && satisfies_red_black_invariants(tree) &&
+               subtree_sizes_are_consistent(tree);
+    };
+
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    for (int round = 0; round < 20; round++)
+    {
+        TreeType bst1{};
+        TreeType bst2{};
+        std::uniform_int_distribution<int> key_distribution(0, 50);
+        for (std::size_t i = 0; i < MAXIMUM_SIZE / 2; i++)
+        {
+            bst1[key_distribution(rng)] = 1;
+            bst2[key_distribution(rng)] = 2;
+        }
+        const std::size_t merged_size = bst1.size() + bst1.count_keys_only_in(bst2);
+        const std::size_t shared_count = bst1.size() + bst2.size() - merged_size;
+
+        bst1.merge_in_place(bst2);
+        ASSERT_EQ(merged_size, bst1.size());
+        ASSERT_EQ(shared_count, bst2.size());
+        ASSERT_TRUE(is_valid(bst1, 0, 50));
+        ASSERT_TRUE(is_valid(bst2, 0, 50));
+        for (NodeIndex i = bst2.index_of_min_at(); i != NULL_INDEX;
+             i = bst2.index_of_successor_at(i))
+        {
+            ASSERT_EQ(1, bst1.node_at(bst1.index_of_node_or_null(bst2.node_at(i).key())).value());
+        }
+
+        const int split_key = key_distribution(rng);
+        TreeType bst3{};
+        bst1.split_into(split_key, bst3);
+        ASSERT_EQ(merged_size, bst1.size() + bst3.size());
+        ASSERT_TRUE(is_valid(bst1, 0, split_key - 1));
+        ASSERT_TRUE(is_valid(bst3, split_key, 50));
+    }
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, MergeAndSplitInPlace)
+{
+    merge_and_split_in_place_test_helper<FixedIndexBasedPoolStorage>();
+    merge_and_split_in_place_test_helper<FixedIndexBasedContiguousStorage>();
+}
+
 }  // namespace fixed_containers::fixed_red_black_tree_detail
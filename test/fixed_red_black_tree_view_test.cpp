@@ -8,12 +8,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <new>
 #include <ranges>
 
 namespace fixed_containers
@@ -124,6 +127,52 @@ TEST(FixedRedBlackTreeView, ViewOfContiguousStorage)
     EXPECT_EQ(var1, var2);
 }
 
+namespace
+{
+template <std::size_t MAXIMUM_SIZE>
+void check_view_of_contiguous_storage()
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using FixedSetType =
+        FixedSet<int, MAXIMUM_SIZE, std::less<>, COMPACTNESS, FixedIndexBasedContiguousStorage>;
+
+    // Fill the padding after the vector's size with garbage, so that reading the size with the
+    // wrong width is noticed
+    auto buf = std::make_unique<std::byte[]>(sizeof(FixedSetType));
+    std::memset(buf.get(), 0xFF, sizeof(FixedSetType));
+    auto* const var1 = new (buf.get()) FixedSetType{};
+    for (int i = 0; i < 20; i++)
+    {
+        var1->insert((i * 7) % 20);
+    }
+
+    auto view = FixedRedBlackTreeRawView(
+        var1,
+        sizeof(typename FixedSetType::value_type),
+        var1->max_size(),
+        COMPACTNESS,
+        fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_CONTIGUOUS);
+
+    EXPECT_EQ(var1->size(), view.size());
+    // The nodes are found at the offset the vector actually uses
+    EXPECT_EQ(reinterpret_cast<const std::byte*>(&*var1->begin()), *view.begin());
+    EXPECT_TRUE(std::ranges::equal(*var1,
+                                   view | std::views::transform(
+                                              [](const std::byte* elm_ptr)
+                                              { return *reinterpret_cast<const int*>(elm_ptr); })));
+
+    var1->~FixedSetType();
+}
+}  // namespace
+
+TEST(FixedRedBlackTreeView, ViewOfContiguousStorageWithEachSizeType)
+{
+    check_view_of_contiguous_storage<30>();
+    check_view_of_contiguous_storage<300>();
+    check_view_of_contiguous_storage<70'000>();
+}
+
 TEST(FixedRedBlackTreeView, PreservedOrdering)
 {
     constexpr auto COMPACTNESS =
@@ -5,6 +5,8 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
 #include "fixed_containers/max_size.hpp"
 
 #include <gtest/gtest.h>
@@ -18,6 +20,7 @@
 #include <ranges>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -691,6 +694,208 @@ TEST(FixedSet, IteratorInvalidation)
     }
 }
 
+TEST(FixedSet, OrderStatistics)
+{
+    using OrderStatisticFixedSet =
+        FixedSet<int,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedPoolStorage,
+                 customize::SetAbortChecking<int, 10>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+
+    constexpr OrderStatisticFixedSet VAL1{2, 4, 6};
+    static_assert(*VAL1.nth(0) == 2);
+    static_assert(*VAL1.nth(2) == 6);
+    static_assert(VAL1.nth(3) == VAL1.cend());
+    static_assert(VAL1.index_of(VAL1.find(4)) == 1);
+    static_assert(VAL1.index_of(VAL1.cend()) == 3);
+    static_assert(VAL1.rank(5) == 2);
+
+    OrderStatisticFixedSet var1{2, 4, 6};
+    var1.insert(3);
+    var1.erase(4);
+    ASSERT_EQ(3, *var1.nth(1));
+    ASSERT_EQ(2, var1.rank(6));
+    ASSERT_EQ(2, var1.index_of(var1.find(6)));
+}
+
+TEST(FixedSet, SetOperations)
+{
+    constexpr FixedSet<int, 10> VAL1{1, 3, 5, 7};
+    constexpr FixedSet<int, 10> VAL2{3, 4, 5, 6};
+
+    static_assert(consteval_compare::equal<6, set_union(VAL1, VAL2).size()>);
+    static_assert(std::ranges::equal(set_union(VAL1, VAL2), std::array{1, 3, 4, 5, 6, 7}));
+    static_assert(std::ranges::equal(set_intersection(VAL1, VAL2), std::array{3, 5}));
+    static_assert(std::ranges::equal(set_difference(VAL1, VAL2), std::array{1, 7}));
+    static_assert(std::ranges::equal(set_difference(VAL2, VAL1), std::array{4, 6}));
+    static_assert(set_union(VAL1, FixedSet<int, 10>{}) == VAL1);
+    static_assert(set_intersection(VAL1, FixedSet<int, 10>{}).empty());
+
+    // The result is a regular set
+    FixedSet<int, 10> var1 = set_union(VAL1, VAL2);
+    var1.insert(2);
+    var1.erase(5);
+    ASSERT_TRUE(std::ranges::equal(var1, std::array{1, 2, 3, 4, 6, 7}));
+}
+
+TEST(FixedSet, SetOperationsExceedingCapacity)
+{
+    constexpr FixedSet<int, 3> VAL1{1, 2, 3};
+    constexpr FixedSet<int, 3> VAL2{4};
+    EXPECT_DEATH((void)set_union(VAL1, VAL2), "");
+}
+
+TEST(FixedSet, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{1, 3, 5};
+        FixedSet<int, 10> other{2, 3, 4};
+        var.merge(other);
+        return std::pair{var, other};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{1, 2, 3, 4, 5}));
+    static_assert(std::ranges::equal(VAL1.second, std::array{3}));
+
+    FixedSet<std::string, 10> var1{"a", "c", "e"};
+    FixedSet<std::string, 10> var2{"b", "c", "d", "f"};
+    var1.merge(var2);
+    ASSERT_TRUE(std::ranges::equal(var1, std::array{"a", "b", "c", "d", "e", "f"}));
+    ASSERT_TRUE(std::ranges::equal(var2, std::array{"c"}));
+
+    var1.merge(FixedSet<std::string, 10>{"g"});
+    ASSERT_EQ(7, var1.size());
+    ASSERT_TRUE(var1.contains("g"));
+
+    var1.merge(var1);
+    ASSERT_EQ(7, var1.size());
+}
+
+TEST(FixedSet, MergeExceedingCapacity)
+{
+    FixedSet<int, 3> var1{1, 2};
+    FixedSet<int, 3> var2{2, 3};
+    var1.merge(var2);
+    ASSERT_TRUE(std::ranges::equal(var1, std::array{1, 2, 3}));
+
+    FixedSet<int, 3> var3{4};
+    EXPECT_DEATH(var1.merge(var3), "");
+}
+
+TEST(FixedSet, Split)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{1, 2, 3, 4, 5};
+        FixedSet<int, 10> upper = var.split(3);
+        return std::pair{var, upper};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{1, 2}));
+    static_assert(std::ranges::equal(VAL1.second, std::array{3, 4, 5}));
+
+    FixedSet<std::string, 10> var1{"a", "b", "d"};
+    FixedSet<std::string, 10> var2 = var1.split("c");
+    ASSERT_TRUE(std::ranges::equal(var1, std::array{"a", "b"}));
+    ASSERT_TRUE(std::ranges::equal(var2, std::array{"d"}));
+
+    FixedSet<std::string, 10> var3 = var1.split("a");
+    ASSERT_TRUE(var1.empty());
+    ASSERT_EQ(2, var3.size());
+    var1.insert("z");
+    ASSERT_EQ(1, var1.size());
+}
+
+TEST(FixedSet, BulkOperationsWithSubtreeSize)
+{
+    using OrderStatisticFixedSet =
+        FixedSet<int,
+                 20,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedPoolStorage,
+                 customize::SetAbortChecking<int, 20>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+
+    OrderStatisticFixedSet var1{0, 2, 4, 6, 8};
+    OrderStatisticFixedSet var2{1, 3, 5, 7, 9, 11, 13};
+    var1.merge(var2);
+    ASSERT_EQ(12, var1.size());
+    for (std::size_t i = 0; i < var1.size(); i++)
+    {
+        ASSERT_EQ(i, var1.index_of(var1.nth(i)));
+    }
+    ASSERT_EQ(11, *var1.nth(10));
+
+    const OrderStatisticFixedSet upper = var1.split(5);
+    ASSERT_EQ(5, var1.rank(100));
+    ASSERT_EQ(5, *upper.nth(0));
+    ASSERT_EQ(3, upper.rank(8));
+}
+
+TEST(FixedSet, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+        erase_if(var, [](const int key) { return key % 3 != 0; });
+        var.compact();
+        var.insert(10);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 3, 6, 9, 10}));
+}
+
+namespace
+{
+// Orders ascending or descending, depending on its state
+struct DirectionalLess
+{
+    bool descending{false};
+
+    bool operator()(const std::string& lhs, const std::string& rhs) const
+    {
+        return descending ? rhs < lhs : lhs < rhs;
+    }
+};
+}  // namespace
+
+TEST(FixedSet, NontrivialAssignmentsCopyTheComparator)
+{
+    using SetType = FixedSet<std::string, 16, DirectionalLess>;
+    SetType descending{DirectionalLess{.descending = true}};
+    for (int i = 0; i < 8; i++)
+    {
+        descending.insert(std::to_string(i));
+    }
+
+    SetType set_1{};
+    set_1.insert("x");
+    set_1 = descending;
+    ASSERT_TRUE(set_1.key_comp().descending);
+    ASSERT_EQ("7", *set_1.begin());
+    for (int i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(set_1.contains(std::to_string(i)));
+    }
+
+    SetType set_2{};
+    set_2.insert("x");
+    set_2 = std::move(set_1);
+    ASSERT_TRUE(set_2.key_comp().descending);
+    for (int i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(set_2.contains(std::to_string(i)));
+    }
+    set_2.insert("8");
+    ASSERT_EQ("8", *set_2.begin());
+}
+
 TEST(FixedSet, Equality)
 {
     constexpr FixedSet<int, 10> VAL1{{1, 4}};
@@ -0,0 +1,112 @@
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_sliding_window.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+namespace fixed_containers
+{
+namespace
+{
+// A deterministic stream of values in [0, 1)
+class ValueStream
+{
+    std::uint64_t state_{88172645463325252ULL};
+
+public:
+    double next()
+    {
+        // xorshift
+        state_ ^= state_ << 13U;
+        state_ ^= state_ >> 7U;
+        state_ ^= state_ << 17U;
+        return static_cast<double>(state_ >> 11U) * 0x1.0p-53;
+    }
+};
+
+// The baseline: one tick pushes a value and rescans the whole window
+template <std::size_t WINDOW_SIZE>
+void benchmark_rescan_min(benchmark::State& state)
+{
+    const auto window = std::make_unique<FixedCircularDeque<double, WINDOW_SIZE>>();
+    ValueStream values{};
+    for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+    {
+        window->push_back(values.next());
+    }
+
+    for (auto _ : state)
+    {
+        window->push_back(values.next());
+        benchmark::DoNotOptimize(*std::min_element(window->begin(), window->end()));
+    }
+}
+
+template <std::size_t WINDOW_SIZE>
+void benchmark_rescan_sum(benchmark::State& state)
+{
+    const auto window = std::make_unique<FixedCircularDeque<double, WINDOW_SIZE>>();
+    ValueStream values{};
+    for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+    {
+        window->push_back(values.next());
+    }
+
+    for (auto _ : state)
+    {
+        window->push_back(values.next());
+        benchmark::DoNotOptimize(std::accumulate(window->begin(), window->end(), 0.0));
+    }
+}
+
+template <std::size_t WINDOW_SIZE, class Op>
+void benchmark_sliding_window(benchmark::State& state)
+{
+    const auto window = std::make_unique<FixedSlidingWindow<double, WINDOW_SIZE, Op>>();
+    ValueStream values{};
+    for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+    {
+        window->push_back(values.next());
+    }
+
+    for (auto _ : state)
+    {
+        window->push_back(values.next());
+        benchmark::DoNotOptimize(window->aggregate());
+    }
+}
+
+// A generic associative operation, so that the two-stack aggregation is used
+struct Plus
+{
+    constexpr double operator()(const double lhs, const double rhs) const { return lhs + rhs; }
+};
+
+using sliding_window_ops::CompensatedSum;
+using sliding_window_ops::Min;
+
+BENCHMARK(benchmark_rescan_min<64>);
+BENCHMARK(benchmark_sliding_window<64, Min<>>);
+BENCHMARK(benchmark_rescan_min<1'024>);
+BENCHMARK(benchmark_sliding_window<1'024, Min<>>);
+BENCHMARK(benchmark_rescan_min<16'384>);
+BENCHMARK(benchmark_sliding_window<16'384, Min<>>);
+
+BENCHMARK(benchmark_rescan_sum<64>);
+BENCHMARK(benchmark_sliding_window<64, CompensatedSum>);
+BENCHMARK(benchmark_sliding_window<64, Plus>);
+BENCHMARK(benchmark_rescan_sum<1'024>);
+BENCHMARK(benchmark_sliding_window<1'024, CompensatedSum>);
+BENCHMARK(benchmark_sliding_window<1'024, Plus>);
+BENCHMARK(benchmark_rescan_sum<16'384>);
+BENCHMARK(benchmark_sliding_window<16'384, CompensatedSum>);
+BENCHMARK(benchmark_sliding_window<16'384, Plus>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
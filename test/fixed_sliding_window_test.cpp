@@ -0,0 +1,217 @@
+#include "fixed_containers/fixed_sliding_window.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_circular_deque.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+
+namespace fixed_containers
+{
+namespace
+{
+using SlidingMinType = FixedSlidingWindow<int, 5, sliding_window_ops::Min<>>;
+static_assert(TriviallyCopyable<SlidingMinType>);
+static_assert(StandardLayout<SlidingMinType>);
+static_assert(IsStructuralType<SlidingMinType>);
+static_assert(IsStructuralType<FixedSlidingWindow<int, 5, std::plus<>>>);
+static_assert(IsStructuralType<FixedSlidingWindow<double, 5, sliding_window_ops::CompensatedSum>>);
+
+// Pseudo-random values with plenty of repeats
+constexpr std::array<int, 40> INPUT = []()
+{
+    std::array<int, 40> out{};
+    std::uint32_t state = 12345;
+    for (int& entry : out)
+    {
+        state = (state * 1'103'515'245U) + 12'345U;
+        entry = static_cast<int>((state >> 16U) % 10U);
+    }
+    return out;
+}();
+
+// Pushes `INPUT` and checks the aggregate after every push against a rescan of the same window
+template <std::size_t WINDOW_SIZE, class Op, class Rescan>
+constexpr bool matches_rescan(const Op& operation, const Rescan& rescan)
+{
+    FixedSlidingWindow<int, WINDOW_SIZE, Op> window{operation};
+    FixedCircularDeque<int, WINDOW_SIZE> reference{};
+    for (const int entry : INPUT)
+    {
+        window.push_back(entry);
+        reference.push_back(entry);
+        if (window.aggregate() != rescan(reference) || !std::ranges::equal(window, reference))
+        {
+            return false;
+        }
+    }
+    // Shrink back down, through the front stack of the two-stack aggregation
+    while (window.size() > 1)
+    {
+        window.pop_front();
+        reference.pop_front();
+        if (window.aggregate() != rescan(reference))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Composition of affine functions `x -> a * x + b`, which is associative but not commutative
+struct Affine
+{
+    std::int64_t a{1};
+    std::int64_t b{0};
+
+    constexpr bool operator==(const Affine& other) const = default;
+};
+struct ComposeAffine
+{
+    // Applies `lhs` first
+    constexpr Affine operator()(const Affine& lhs, const Affine& rhs) const
+    {
+        return {rhs.a * lhs.a, (rhs.a * lhs.b) + rhs.b};
+    }
+};
+}  // namespace
+
+TEST(FixedSlidingWindow, DefaultConstructor)
+{
+    constexpr FixedSlidingWindow<int, 8, sliding_window_ops::Max<>> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+    static_assert(!is_full(VAL1));
+}
+
+TEST(FixedSlidingWindow, PushBackEvictsOldest)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSlidingWindow<int, 3, std::plus<>> var{};
+        for (int i = 1; i <= 5; i++)
+        {
+            var.push_back(i);
+        }
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{3, 4, 5}));
+    static_assert(is_full(VAL1));
+    static_assert(VAL1.front() == 3);
+    static_assert(VAL1.back() == 5);
+    static_assert(VAL1.aggregate() == 12);
+}
+
+TEST(FixedSlidingWindow, MinAndMax)
+{
+    constexpr auto MIN_RESCAN = [](const auto& window) { return std::ranges::min(window); };
+    constexpr auto MAX_RESCAN = [](const auto& window) { return std::ranges::max(window); };
+    static_assert(matches_rescan<1>(sliding_window_ops::Min<>{}, MIN_RESCAN));
+    static_assert(matches_rescan<4>(sliding_window_ops::Min<>{}, MIN_RESCAN));
+    static_assert(matches_rescan<7>(sliding_window_ops::Max<>{}, MAX_RESCAN));
+    static_assert(matches_rescan<7>(sliding_window_ops::Min<std::greater<>>{}, MAX_RESCAN));
+}
+
+TEST(FixedSlidingWindow, TwoStackAggregation)
+{
+    constexpr auto SUM_RESCAN = [](const auto& window)
+    { return std::accumulate(window.begin(), window.end(), 0); };
+    static_assert(matches_rescan<1>(std::plus<>{}, SUM_RESCAN));
+    static_assert(matches_rescan<6>(std::plus<>{}, SUM_RESCAN));
+
+    constexpr auto BIT_OR_RESCAN = [](const auto& window)
+    { return std::accumulate(window.begin(), window.end(), 0, std::bit_or<>{}); };
+    static_assert(matches_rescan<5>(std::bit_or<>{}, BIT_OR_RESCAN));
+}
+
+TEST(FixedSlidingWindow, NonCommutativeOperation)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSlidingWindow<Affine, 3, ComposeAffine> var{};
+        for (std::int64_t i = 1; i <= 4; i++)
+        {
+            var.push_back({i, i});
+        }
+        return var;
+    }();
+
+    // The window holds x -> 2x + 2, then x -> 3x + 3, then x -> 4x + 4
+    static_assert(VAL1.aggregate() == Affine{24, 40});
+
+    constexpr auto VAL2 = []()
+    {
+        FixedSlidingWindow<Affine, 3, ComposeAffine> var{};
+        for (std::int64_t i = 1; i <= 4; i++)
+        {
+            var.push_back({i, i});
+        }
+        var.pop_front();
+        var.push_back({5, 5});
+        return var;
+    }();
+    static_assert(VAL2.aggregate() == Affine{60, 85});
+}
+
+TEST(FixedSlidingWindow, CompensatedSum)
+{
+    FixedSlidingWindow<double, 4, sliding_window_ops::CompensatedSum> var1{};
+    // A large value that leaves the window, around small ones that a plain running sum would lose
+    var1.push_back(1.0);
+    var1.push_back(1e100);
+    var1.push_back(1.0);
+    var1.push_back(-1e100);
+    EXPECT_EQ(2.0, var1.aggregate());
+    var1.push_back(0.5);
+    EXPECT_EQ(1.5, var1.aggregate());
+    // Both large values leave the window
+    var1.pop_front();
+    var1.pop_front();
+    var1.pop_front();
+    EXPECT_EQ(0.5, var1.aggregate());
+    var1.push_back(1.5);
+    // The mean
+    EXPECT_EQ(1.0, var1.aggregate() / static_cast<double>(var1.size()));
+
+    // Many small values, each of which is added and subtracted again
+    FixedSlidingWindow<double, 10, sliding_window_ops::CompensatedSum> var2{};
+    for (int i = 0; i < 100'000; i++)
+    {
+        var2.push_back(0.1);
+    }
+    EXPECT_DOUBLE_EQ(1.0, var2.aggregate());
+    EXPECT_NEAR(1.0, var2.aggregate(), 1e-15);
+}
+
+TEST(FixedSlidingWindow, Clear)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSlidingWindow<int, 3, std::plus<>> var{};
+        var.push_back(1);
+        var.push_back(2);
+        var.pop_front();
+        var.clear();
+        var.push_back(7);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 1);
+    static_assert(VAL1.aggregate() == 7);
+}
+
+TEST(FixedSlidingWindow, EmptyWindowAccess)
+{
+    FixedSlidingWindow<int, 3, sliding_window_ops::Min<>> var1{};
+    EXPECT_DEATH((void)var1.aggregate(), "");
+    EXPECT_DEATH(var1.pop_front(), "");
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,229 @@
+#if defined(__clang__) && __clang_major__ >= 15
+
+#include "fixed_containers/fixed_soa_vector.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Particle
+{
+    float position_x;
+    float position_y;
+    float velocity_x;
+    float velocity_y;
+    int id;
+
+    constexpr bool operator==(const Particle& other) const = default;
+};
+
+constexpr Particle make_particle(const int id)
+{
+    const auto value = static_cast<float>(id);
+    return {value, value * 2, 1.0F, -1.0F, id};
+}
+
+using SoAVectorType = FixedSoAVector<Particle, 5>;
+static_assert(TriviallyCopyable<SoAVectorType>);
+static_assert(StandardLayout<SoAVectorType>);
+static_assert(IsStructuralType<SoAVectorType>);
+static_assert(ConstexprDefaultConstructible<SoAVectorType>);
+
+static_assert(std::random_access_iterator<SoAVectorType::iterator>);
+static_assert(std::random_access_iterator<SoAVectorType::const_iterator>);
+static_assert(std::is_same_v<SoAVectorType::field_type<0>, float>);
+static_assert(std::is_same_v<SoAVectorType::field_type<4>, int>);
+}  // namespace
+
+TEST(FixedSoAVector, DefaultConstructor)
+{
+    constexpr FixedSoAVector<Particle, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+    static_assert(max_size_v<FixedSoAVector<Particle, 8>> == 8);
+}
+
+TEST(FixedSoAVector, PushBackAndAccess)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Particle, 4> var{};
+        var.push_back(make_particle(1));
+        var.push_back(make_particle(2));
+        var.push_back(make_particle(3));
+        return var;
+    }();
+    static_assert(VAL1.size() == 3);
+    static_assert(static_cast<Particle>(VAL1[1]) == make_particle(2));
+    static_assert(VAL1.front().get<4>() == 1);
+    static_assert(VAL1.back().get<1>() == 6.0F);
+
+    FixedSoAVector<Particle, 2> var1{make_particle(5)};
+    const Particle particle = var1.at(0);
+    EXPECT_EQ(make_particle(5), particle);
+
+    var1[0] = make_particle(7);
+    EXPECT_EQ(7, var1[0].get<4>());
+    var1[0].get<4>() = 8;
+    EXPECT_EQ(8, var1.field<4>()[0]);
+
+    var1.push_back(make_particle(9));
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.push_back(make_particle(10)), "");
+    EXPECT_DEATH((void)var1.at(2), "");
+}
+
+TEST(FixedSoAVector, Fields)
+{
+    FixedSoAVector<Particle, 16> var1{};
+    for (int i = 0; i < 10; i++)
+    {
+        var1.push_back(make_particle(i));
+    }
+
+    // The loop a structure of arrays is meant for: only two arrays are touched
+    const std::span<float> position_x = var1.field<0>();
+    const std::span<const float> velocity_x = std::as_const(var1).field<2>();
+    ASSERT_EQ(10, position_x.size());
+    for (std::size_t i = 0; i < position_x.size(); i++)
+    {
+        position_x[i] += velocity_x[i];
+    }
+
+    for (std::size_t i = 0; i < var1.size(); i++)
+    {
+        const Particle particle = var1[i];
+        EXPECT_EQ(static_cast<float>(i) + 1.0F, particle.position_x);
+        EXPECT_EQ(static_cast<int>(i), particle.id);
+    }
+    const std::span<const int> ids = std::as_const(var1).field<4>();
+    EXPECT_EQ(45, std::accumulate(ids.begin(), ids.end(), 0));
+}
+
+TEST(FixedSoAVector, Iterators)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Particle, 4> var{};
+        var.push_back(make_particle(1));
+        var.push_back(make_particle(2));
+        var.push_back(make_particle(3));
+        return var;
+    }();
+
+    int sum = 0;
+    for (const Particle particle : VAL1)
+    {
+        sum += particle.id;
+    }
+    EXPECT_EQ(6, sum);
+    EXPECT_EQ(3, std::distance(VAL1.begin(), VAL1.end()));
+    EXPECT_EQ(3, VAL1.rbegin()->get<4>());
+    EXPECT_EQ(1, std::prev(VAL1.rend())->get<4>());
+
+    FixedSoAVector<Particle, 4> var1 = VAL1;
+    for (auto element : var1)
+    {
+        element.get<4>() *= 10;
+    }
+    EXPECT_EQ(30, var1.back().get<4>());
+
+    // Assigning an element to another copies the fields, not the proxy
+    *var1.begin() = *std::prev(var1.end());
+    EXPECT_EQ(static_cast<Particle>(var1[0]), static_cast<Particle>(var1[2]));
+}
+
+TEST(FixedSoAVector, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Particle, 8> var{};
+        for (int i = 0; i < 6; i++)
+        {
+            var.push_back(make_particle(i));
+        }
+        var.erase(std::next(var.cbegin(), 1), std::next(var.cbegin(), 3));
+        var.erase(var.cbegin());
+        return var;
+    }();
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1[0].get<4>() == 3);
+    static_assert(VAL1[1].get<4>() == 4);
+    static_assert(VAL1[2].get<4>() == 5);
+    static_assert(VAL1[2].get<0>() == 5.0F);
+
+    FixedSoAVector<Particle, 8> var1 = VAL1;
+    auto it = var1.erase(std::next(var1.cbegin(), 2));
+    EXPECT_EQ(var1.end(), it);
+    EXPECT_EQ(2, var1.size());
+    EXPECT_DEATH(var1.erase(var1.cend(), var1.cbegin()), "");
+}
+
+TEST(FixedSoAVector, UnorderedErase)
+{
+    FixedSoAVector<Particle, 8> var1{};
+    for (int i = 0; i < 4; i++)
+    {
+        var1.push_back(make_particle(i));
+    }
+
+    auto it = var1.unordered_erase(var1.cbegin());
+    EXPECT_EQ(var1.begin(), it);
+    EXPECT_EQ(make_particle(3), static_cast<Particle>(var1[0]));
+    EXPECT_EQ(3, var1.size());
+
+    it = var1.unordered_erase(std::prev(var1.cend()));
+    EXPECT_EQ(var1.end(), it);
+    EXPECT_EQ(2, var1.size());
+    EXPECT_EQ(make_particle(1), static_cast<Particle>(var1[1]));
+
+    EXPECT_DEATH(var1.unordered_erase(var1.cend()), "");
+}
+
+TEST(FixedSoAVector, PopBackAndClear)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Particle, 4> var{};
+        var.push_back(make_particle(1));
+        var.push_back(make_particle(2));
+        var.pop_back();
+        return var;
+    }();
+    static_assert(VAL1.size() == 1);
+    static_assert(VAL1.back().get<4>() == 1);
+
+    FixedSoAVector<Particle, 4> var1 = VAL1;
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_DEATH(var1.pop_back(), "");
+    EXPECT_DEATH((void)var1.front(), "");
+}
+
+TEST(FixedSoAVector, Equality)
+{
+    constexpr FixedSoAVector<Particle, 4> VAL1{make_particle(1), make_particle(2)};
+    constexpr FixedSoAVector<Particle, 8> VAL2{make_particle(1), make_particle(2)};
+    constexpr FixedSoAVector<Particle, 4> VAL3{make_particle(1), make_particle(3)};
+    constexpr FixedSoAVector<Particle, 4> VAL4{make_particle(1)};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+    static_assert(VAL1 != VAL4);
+}
+
+}  // namespace fixed_containers
+
+#endif
@@ -0,0 +1,188 @@
+#include "fixed_containers/fixed_circular_queue.hpp"
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAPACITY = 1'024;
+constexpr std::size_t BATCH_SIZE = 64;
+
+// The baseline: a FixedCircularQueue guarded by a mutex, refusing pushes instead of overwriting
+template <typename T, std::size_t MAXIMUM_SIZE>
+class MutexGuardedQueue
+{
+    std::mutex mutex_{};
+    FixedCircularQueue<T, MAXIMUM_SIZE> queue_{};
+
+public:
+    bool try_push(const T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (is_full(queue_))
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+
+    std::optional<T> try_pop()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (queue_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{queue_.front()};
+        queue_.pop();
+        return out;
+    }
+};
+
+// Waiting yields, so that the benchmarks also make progress on a single core
+template <typename QueueType>
+void push_blocking(QueueType& queue, const std::uint64_t value)
+{
+    while (!queue.try_push(value))
+    {
+        std::this_thread::yield();
+    }
+}
+template <typename QueueType>
+std::uint64_t pop_blocking(QueueType& queue)
+{
+    std::optional<std::uint64_t> value = queue.try_pop();
+    while (!value.has_value())
+    {
+        std::this_thread::yield();
+        value = queue.try_pop();
+    }
+    return *value;
+}
+
+// Round trip of one message to another thread and back
+template <typename QueueType>
+void benchmark_queue_ping_pong(benchmark::State& state)
+{
+    const auto requests = std::make_unique<QueueType>();
+    const auto responses = std::make_unique<QueueType>();
+    std::atomic<bool> done{false};
+
+    std::thread echo{[&]()
+                     {
+                         while (!done.load(std::memory_order_relaxed))
+                         {
+                             if (const std::optional<std::uint64_t> value = requests->try_pop())
+                             {
+                                 push_blocking(*responses, *value);
+                             }
+                             else
+                             {
+                                 std::this_thread::yield();
+                             }
+                         }
+                     }};
+
+    std::uint64_t i = 0;
+    for (auto _ : state)
+    {
+        push_blocking(*requests, i++);
+        benchmark::DoNotOptimize(pop_blocking(*responses));
+    }
+
+    done.store(true, std::memory_order_relaxed);
+    echo.join();
+}
+
+// One-way throughput, pushing and popping one message at a time
+template <typename QueueType>
+void benchmark_queue_streaming(benchmark::State& state)
+{
+    const auto queue = std::make_unique<QueueType>();
+    const auto message_count = static_cast<std::uint64_t>(state.max_iterations);
+
+    std::thread consumer{[&]()
+                         {
+                             for (std::uint64_t i = 0; i < message_count; i++)
+                             {
+                                 benchmark::DoNotOptimize(pop_blocking(*queue));
+                             }
+                         }};
+
+    std::uint64_t i = 0;
+    for (auto _ : state)
+    {
+        push_blocking(*queue, i++);
+    }
+    consumer.join();
+    state.SetItemsProcessed(state.iterations());
+}
+
+// One-way throughput, pushing and popping up to `BATCH_SIZE` messages at a time
+void benchmark_spsc_queue_streaming_batched(benchmark::State& state)
+{
+    const auto queue = std::make_unique<FixedSpscQueue<std::uint64_t, CAPACITY>>();
+    const auto message_count = static_cast<std::uint64_t>(state.max_iterations) * BATCH_SIZE;
+
+    std::thread consumer{[&]()
+                         {
+                             std::array<std::uint64_t, BATCH_SIZE> batch{};
+                             std::uint64_t popped_count = 0;
+                             while (popped_count < message_count)
+                             {
+                                 const std::size_t count =
+                                     queue->try_pop_n(batch.begin(), batch.size());
+                                 benchmark::DoNotOptimize(batch);
+                                 popped_count += count;
+                                 if (count == 0)
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                             }
+                         }};
+
+    std::array<std::uint64_t, BATCH_SIZE> batch{};
+    for (auto _ : state)
+    {
+        std::size_t pushed_count = 0;
+        while (pushed_count < batch.size())
+        {
+            const auto first = std::next(batch.begin(), static_cast<std::ptrdiff_t>(pushed_count));
+            const std::size_t count = queue->try_push_n(first, batch.size() - pushed_count);
+            pushed_count += count;
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+    consumer.join();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH_SIZE));
+}
+
+using MutexQueue = MutexGuardedQueue<std::uint64_t, CAPACITY>;
+using SpscQueue = FixedSpscQueue<std::uint64_t, CAPACITY>;
+
+BENCHMARK(benchmark_queue_ping_pong<MutexQueue>)->UseRealTime();
+BENCHMARK(benchmark_queue_ping_pong<SpscQueue>)->UseRealTime();
+
+BENCHMARK(benchmark_queue_streaming<MutexQueue>)->UseRealTime();
+BENCHMARK(benchmark_queue_streaming<SpscQueue>)->UseRealTime();
+BENCHMARK(benchmark_spsc_queue_streaming_batched)->UseRealTime();
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,175 @@
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/cache_line.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using SpscQueueType = FixedSpscQueue<int, 5>;
+static_assert(StandardLayout<SpscQueueType>);
+static_assert(!std::is_copy_constructible_v<SpscQueueType>);
+static_assert(!std::is_move_constructible_v<SpscQueueType>);
+static_assert(alignof(SpscQueueType) == CACHE_LINE_SIZE);
+static_assert(SpscQueueType::static_max_size() == 5);
+
+struct FixedSpscQueueInstanceCounterUniquenessToken
+{
+};
+using InstanceCounterNonTrivialAssignment = instance_counter::InstanceCounterNonTrivialAssignment<
+    FixedSpscQueueInstanceCounterUniquenessToken>;
+}  // namespace
+
+TEST(FixedSpscQueue, DefaultConstructor)
+{
+    const FixedSpscQueue<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(8, var1.max_size());
+}
+
+TEST(FixedSpscQueue, PushAndPop)
+{
+    // A capacity that is not a power of two, so that the indices wrap around with a division
+    FixedSpscQueue<int, 3> var1{};
+    for (int round = 0; round < 4; round++)
+    {
+        EXPECT_TRUE(var1.try_push(round));
+        const int value = round + 1;
+        EXPECT_TRUE(var1.try_push(value));
+        EXPECT_TRUE(var1.try_emplace(round + 2));
+        EXPECT_FALSE(var1.try_push(99));
+        EXPECT_EQ(3, var1.size());
+
+        EXPECT_EQ(round, var1.try_pop());
+        EXPECT_EQ(round + 1, var1.try_pop());
+        EXPECT_EQ(round + 2, var1.try_pop());
+        EXPECT_EQ(std::nullopt, var1.try_pop());
+        EXPECT_TRUE(var1.empty());
+    }
+}
+
+TEST(FixedSpscQueue, PushNAndPopN)
+{
+    FixedSpscQueue<int, 5> var1{};
+    const std::array<int, 7> entries{0, 1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(3, var1.try_push_n(entries.begin(), 3));
+    std::array<int, 7> out{};
+    EXPECT_EQ(2, var1.try_pop_n(out.begin(), 2));
+    EXPECT_EQ((std::array<int, 7>{0, 1, 0, 0, 0, 0, 0}), out);
+
+    // Only 4 slots are free, and they wrap around the end of the storage
+    EXPECT_EQ(4, var1.try_push_n(std::next(entries.begin(), 3), 4));
+    EXPECT_EQ(0, var1.try_push_n(entries.begin(), 1));
+    EXPECT_EQ(5, var1.size());
+
+    EXPECT_EQ(5, var1.try_pop_n(out.begin(), 7));
+    EXPECT_EQ((std::array<int, 7>{2, 3, 4, 5, 6, 0, 0}), out);
+    EXPECT_EQ(0, var1.try_pop_n(out.begin(), 7));
+
+    // Input iterators and non-contiguous destinations
+    MockIntegralStream<int> stream{3};
+    EXPECT_EQ(3, var1.try_push_n(stream.begin(), 3));
+    std::vector<int> out2{};
+    EXPECT_EQ(3, var1.try_pop_n(std::back_inserter(out2), 3));
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), out2);
+}
+
+TEST(FixedSpscQueue, NonTriviallyDestructible)
+{
+    using T = InstanceCounterNonTrivialAssignment;
+    ASSERT_EQ(0, T::counter);
+    {
+        FixedSpscQueue<T, 4> var1{};
+        const std::array<T, 3> entries{1, 2, 3};
+        EXPECT_EQ(3, var1.try_push_n(entries.begin(), 3));
+        EXPECT_EQ(6, T::counter);
+
+        std::optional<T> popped = var1.try_pop();
+        ASSERT_TRUE(popped.has_value());
+        EXPECT_EQ(1, popped->get());
+        EXPECT_EQ(6, T::counter);
+        popped.reset();
+
+        std::vector<T> out{};
+        EXPECT_EQ(1, var1.try_pop_n(std::back_inserter(out), 1));
+        EXPECT_EQ(2, out.front().get());
+        EXPECT_EQ(5, T::counter);
+    }
+    // The destructor destroys the element that was never popped
+    EXPECT_EQ(0, T::counter);
+}
+
+TEST(FixedSpscQueue, ProducerAndConsumerThreads)
+{
+    static constexpr std::uint64_t ELEMENT_COUNT = 100'000;
+    FixedSpscQueue<std::uint64_t, 100> var1{};
+
+    std::thread producer{[&var1]()
+                         {
+                             std::array<std::uint64_t, 7> batch{};
+                             std::uint64_t next = 0;
+                             while (next < ELEMENT_COUNT)
+                             {
+                                 // Alternate between single and batched pushes
+                                 if (next % 2 == 0)
+                                 {
+                                     if (var1.try_push(next))
+                                     {
+                                         next++;
+                                     }
+                                     continue;
+                                 }
+                                 const std::size_t batch_size = (std::min<std::uint64_t>)(
+                                     batch.size(), ELEMENT_COUNT - next);
+                                 for (std::size_t i = 0; i < batch_size; i++)
+                                 {
+                                     batch.at(i) = next + i;
+                                 }
+                                 next += var1.try_push_n(batch.begin(), batch_size);
+                                 std::this_thread::yield();
+                             }
+                         }};
+
+    std::uint64_t expected = 0;
+    bool in_order = true;
+    std::array<std::uint64_t, 11> batch{};
+    while (expected < ELEMENT_COUNT)
+    {
+        if (const std::optional<std::uint64_t> value = var1.try_pop(); value.has_value())
+        {
+            in_order = in_order && *value == expected;
+            expected++;
+        }
+        const std::size_t popped_count = var1.try_pop_n(batch.begin(), batch.size());
+        for (std::size_t i = 0; i < popped_count; i++)
+        {
+            in_order = in_order && batch.at(i) == expected;
+            expected++;
+        }
+        std::this_thread::yield();
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(ELEMENT_COUNT, expected);
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
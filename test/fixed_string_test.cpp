@@ -5,11 +5,13 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
 #include <iterator>
 #include <span>
@@ -27,6 +29,11 @@ static_assert(TriviallyCopyable<FixedStringType>);
 static_assert(NotTrivial<FixedStringType>);
 static_assert(StandardLayout<FixedStringType>);
 static_assert(IsStructuralType<FixedStringType>);
+// The length is stored in the last byte, which is also the null terminator when full
+static_assert(consteval_compare::equal<16, sizeof(FixedString<15>)>);
+static_assert(consteval_compare::equal<24, sizeof(FixedString<23>)>);
+static_assert(consteval_compare::equal<256, sizeof(FixedString<255>)>);
+static_assert(consteval_compare::equal<260, sizeof(FixedString<256>)>);
 
 static_assert(std::contiguous_iterator<FixedStringType::iterator>);
 static_assert(std::contiguous_iterator<FixedStringType::const_iterator>);
@@ -407,13 +414,14 @@ TEST(FixedString, Data)
         static_assert(*std::next(VAL1.data(), 1) == '1');
         static_assert(*std::next(VAL1.data(), 2) == '2');
         static_assert(*std::next(VAL1.data(), 3) == '\0');
-        static_assert(*std::next(VAL1.data(), 8) == '\0');
+        // The last byte holds the remaining capacity
+        static_assert(*std::next(VAL1.data(), 8) == 5);
 
         EXPECT_EQ(*std::next(VAL1.data(), 0), '0');
         EXPECT_EQ(*std::next(VAL1.data(), 1), '1');
         EXPECT_EQ(*std::next(VAL1.data(), 2), '2');
         EXPECT_EQ(*std::next(VAL1.data(), 3), '\0');
-        EXPECT_EQ(*std::next(VAL1.data(), 8), '\0');
+        EXPECT_EQ(*std::next(VAL1.data(), 8), 5);
 
         static_assert(VAL1.size() == 3);
     }
@@ -444,13 +452,14 @@ TEST(FixedString, CStr)
         static_assert(*std::next(VAL1.c_str(), 1) == '1');
         static_assert(*std::next(VAL1.c_str(), 2) == '2');
         static_assert(*std::next(VAL1.c_str(), 3) == '\0');
-        static_assert(*std::next(VAL1.c_str(), 8) == '\0');
+        // The last byte holds the remaining capacity
+        static_assert(*std::next(VAL1.c_str(), 8) == 5);
 
         EXPECT_EQ(*std::next(VAL1.c_str(), 0), '0');
         EXPECT_EQ(*std::next(VAL1.c_str(), 1), '1');
         EXPECT_EQ(*std::next(VAL1.c_str(), 2), '2');
         EXPECT_EQ(*std::next(VAL1.c_str(), 3), '\0');
-        EXPECT_EQ(*std::next(VAL1.c_str(), 8), '\0');
+        EXPECT_EQ(*std::next(VAL1.c_str(), 8), 5);
 
         static_assert(VAL1.size() == 3);
     }
@@ -1824,6 +1833,64 @@ TEST(FixedString, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+TEST(FixedString, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<7> var{"012"};
+        var.resize_for_overwrite(5);
+        var[3] = '3';
+        var[4] = '4';
+        var.resize_for_overwrite(4);
+        return var;
+    }();
+
+    static_assert(VAL1 == "0123");
+    static_assert(*std::next(VAL1.c_str(), 4) == '\0');
+
+    FixedString<8> var2{"ab"};
+    var2.resize_for_overwrite(5);
+    std::copy_n("cde", 3, std::next(var2.data(), 2));
+    EXPECT_EQ(var2, "abcde");
+    EXPECT_EQ('\0', *std::next(var2.c_str(), 5));
+
+    EXPECT_DEATH(var2.resize_for_overwrite(9), "");
+}
+
+TEST(FixedString, AppendWith)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<7> var{"01"};
+        var.append_with(4,
+                        [](char* first, const std::size_t count)
+                        {
+                            // Only fills 2 out of the 4 characters
+                            std::fill_n(first, count / 2, 'x');
+                            return count / 2;
+                        });
+        return var;
+    }();
+
+    static_assert(VAL1 == "01xx");
+    static_assert(*std::next(VAL1.c_str(), 4) == '\0');
+
+    FixedString<8> var2{"a"};
+    var2.append_with(7,
+                     [](char* first, const std::size_t count)
+                     {
+                         std::fill_n(first, count, 'b');
+                         return count;
+                     });
+    EXPECT_EQ(var2, "abbbbbbb");
+
+    const auto writes_none = [](char* /*first*/, std::size_t /*count*/) { return 0; };
+    const auto writes_three = [](char* /*first*/, std::size_t /*count*/) { return 3; };
+    EXPECT_DEATH(var2.append_with(1, writes_none), "");
+    var2.clear();
+    EXPECT_DEATH(var2.append_with(2, writes_three), "");
+}
+
 TEST(FixedString, Full)
 {
     constexpr auto VAL1 = []()
@@ -1844,6 +1911,79 @@ TEST(FixedString, Full)
     EXPECT_TRUE(is_full(VAL1));
 }
 
+TEST(FixedString, LengthStorage)
+{
+    // Up to 255 characters, the length is stored in the last byte
+    constexpr auto VAL1 = []()
+    {
+        FixedString<255> var(255, 'a');
+        var.pop_back();
+        var.erase(var.begin(), std::next(var.begin(), 100));
+        return var;
+    }();
+    static_assert(VAL1.size() == 154);
+    static_assert(*std::next(VAL1.c_str(), 154) == '\0');
+
+    constexpr FixedString<255> VAL2(255, 'b');
+    static_assert(VAL2.size() == 255);
+    static_assert(*std::next(VAL2.c_str(), 255) == '\0');
+
+    // Longer strings store it separately
+    FixedString<300> var3(299, 'c');
+    EXPECT_EQ(299, var3.size());
+    var3.push_back('d');
+    EXPECT_EQ(300, var3.size());
+    EXPECT_TRUE(is_full(var3));
+    EXPECT_EQ('\0', *std::next(var3.c_str(), 300));
+    var3.resize(10);
+    EXPECT_EQ(std::string_view{"cccccccccc"}, var3);
+}
+
+TEST(FixedString, ZeroUnusedTail)
+{
+    using ZeroedString =
+        FixedString<20, customize::SequenceContainerZeroUnusedTailAbortChecking<char, 20>>;
+    const auto has_zeroed_tail = [](const ZeroedString& str)
+    {
+        return std::all_of(std::next(str.data(), static_cast<std::ptrdiff_t>(str.size())),
+                           std::next(str.data(), 20),
+                           [](const char character) { return character == '\0'; });
+    };
+
+    ZeroedString var1{"0123456789abcdef"};
+    EXPECT_TRUE(has_zeroed_tail(var1));
+    var1.erase(std::next(var1.begin(), 2), std::next(var1.begin(), 5));
+    var1.pop_back();
+    EXPECT_EQ(std::string_view{"0156789abcde"}, var1);
+    EXPECT_TRUE(has_zeroed_tail(var1));
+    var1.resize(4);
+    EXPECT_TRUE(has_zeroed_tail(var1));
+
+    const ZeroedString var2{"0156"};
+    EXPECT_EQ(var1, var2);
+    EXPECT_EQ(std::strong_ordering::equal, var1 <=> var2);
+
+    // Embedded nulls only differ in length
+    ZeroedString var3{"0156"};
+    var3.push_back('\0');
+    EXPECT_NE(var1, var3);
+    EXPECT_LT(var1, var3);
+
+    for (const std::string_view lhs : {"", "a", "ab", "b", "abcdefghijk", "abcdefghijl", "\xff"})
+    {
+        for (const std::string_view rhs : {"", "a", "abc", "b", "abcdefghijk", "abcdefghij", "z"})
+        {
+            const ZeroedString lhs_string{lhs};
+            const ZeroedString rhs_string{rhs};
+            EXPECT_EQ(lhs == rhs, lhs_string == rhs_string);
+            EXPECT_EQ(lhs <=> rhs, lhs_string <=> rhs_string);
+        }
+    }
+
+    static_assert(ZeroedString{"abc"} < ZeroedString{"abd"});
+    static_assert(ZeroedString{"abc"} == ZeroedString{"abc"});
+}
+
 TEST(FixedString, Span)
 {
     {
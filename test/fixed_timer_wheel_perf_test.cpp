@@ -0,0 +1,114 @@
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_timer_wheel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t SESSION_COUNT = 8'192;
+constexpr std::uint64_t TIMEOUT = 30'000;
+
+// Session timeouts: every tick, a few sessions see traffic and push their timeout back, and the
+// sessions that stayed idle for `TIMEOUT` ticks expire and are opened again
+class Traffic
+{
+    std::uint64_t state_{88172645463325252ULL};
+
+public:
+    std::size_t next_session()
+    {
+        // xorshift
+        state_ ^= state_ << 13U;
+        state_ ^= state_ >> 7U;
+        state_ ^= state_ << 17U;
+        return static_cast<std::size_t>(state_ % SESSION_COUNT);
+    }
+};
+
+constexpr std::size_t TOUCHES_PER_TICK = 8;
+
+// The baseline: an ordered map from (deadline, session) to session, plus the key of each session
+void benchmark_session_timeouts_ordered_map(benchmark::State& state)
+{
+    using Key = std::pair<std::uint64_t, std::size_t>;
+    const auto timers = std::make_unique<FixedMap<Key, std::size_t, SESSION_COUNT>>();
+    const auto keys = std::make_unique<std::array<Key, SESSION_COUNT>>();
+    Traffic traffic{};
+    std::uint64_t now = 0;
+    for (std::size_t session = 0; session < SESSION_COUNT; session++)
+    {
+        (*keys)[session] = {now + TIMEOUT - session, session};
+        timers->try_emplace((*keys)[session], session);
+    }
+
+    std::size_t expired_count = 0;
+    for (auto _ : state)
+    {
+        now++;
+        for (std::size_t i = 0; i < TOUCHES_PER_TICK; i++)
+        {
+            const std::size_t session = traffic.next_session();
+            timers->erase((*keys)[session]);
+            (*keys)[session] = {now + TIMEOUT, session};
+            timers->try_emplace((*keys)[session], session);
+        }
+        while (!timers->empty() && timers->begin()->first.first <= now)
+        {
+            const std::size_t session = timers->begin()->second;
+            timers->erase(timers->begin());
+            expired_count++;
+            (*keys)[session] = {now + TIMEOUT, session};
+            timers->try_emplace((*keys)[session], session);
+        }
+    }
+    benchmark::DoNotOptimize(expired_count);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void benchmark_session_timeouts_timer_wheel(benchmark::State& state)
+{
+    using WheelType = FixedTimerWheel<std::size_t, SESSION_COUNT>;
+    const auto timers = std::make_unique<WheelType>();
+    const auto handles = std::make_unique<std::array<WheelType::handle_type, SESSION_COUNT>>();
+    const auto expired = std::make_unique<std::array<std::size_t, SESSION_COUNT>>();
+    Traffic traffic{};
+    for (std::size_t session = 0; session < SESSION_COUNT; session++)
+    {
+        (*handles)[session] = timers->schedule_after(TIMEOUT - session, session);
+    }
+
+    std::size_t expired_count = 0;
+    for (auto _ : state)
+    {
+        const std::uint64_t now = timers->now() + 1;
+        for (std::size_t i = 0; i < TOUCHES_PER_TICK; i++)
+        {
+            const std::size_t session = traffic.next_session();
+            timers->reschedule((*handles)[session], now + TIMEOUT);
+        }
+        const std::size_t count = timers->advance(now, expired->begin());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::size_t session = (*expired)[i];
+            (*handles)[session] = timers->schedule(now + TIMEOUT, session);
+        }
+        expired_count += count;
+    }
+    benchmark::DoNotOptimize(expired_count);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(benchmark_session_timeouts_ordered_map);
+BENCHMARK(benchmark_session_timeouts_timer_wheel);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,251 @@
+#include "fixed_containers/fixed_timer_wheel.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using TimerWheelType = FixedTimerWheel<int, 16, 8, 3>;
+static_assert(TriviallyCopyable<TimerWheelType>);
+static_assert(IsStructuralType<TimerWheelType>);
+static_assert(IsStructuralType<FixedTimerWheel<int, 16>>);
+
+// Schedules pseudo-random deadlines, with some cancelled and rescheduled along the way, and
+// checks that `advance()` in steps of `STEP` ticks expires them in the same order as a sort
+template <std::size_t SLOTS, std::size_t LEVELS, std::uint64_t STEP>
+constexpr bool matches_sorted_deadlines(const std::uint64_t max_delay)
+{
+    constexpr std::size_t TIMER_COUNT = 48;
+    FixedTimerWheel<std::size_t, TIMER_COUNT, SLOTS, LEVELS> wheel{1'000};
+    std::array<std::pair<std::uint64_t, std::size_t>, TIMER_COUNT> expected{};
+    std::size_t expected_count = 0;
+
+    std::uint64_t state = 88172645463325252ULL;
+    const auto next_random = [&]()
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        return state;
+    };
+
+    FixedVector<std::pair<std::uint64_t, typename decltype(wheel)::handle_type>, TIMER_COUNT>
+        handles{};
+    for (std::size_t i = 0; i < TIMER_COUNT; i++)
+    {
+        const std::uint64_t deadline = wheel.now() + 1 + (next_random() % max_delay);
+        handles.push_back({deadline, wheel.schedule(deadline, i)});
+    }
+    for (std::size_t i = 0; i < TIMER_COUNT; i++)
+    {
+        auto& [deadline, handle] = handles[i];
+        if (i % 5 == 0)
+        {
+            wheel.cancel(handle);
+            continue;
+        }
+        if (i % 7 == 0)
+        {
+            deadline = wheel.now() + 1 + (next_random() % max_delay);
+            wheel.reschedule(handle, deadline);
+        }
+        expected[expected_count++] = {deadline, i};
+    }
+    // Timers with the same deadline expire in the order of the slot they share, so compare
+    // deadlines only
+    std::sort(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(expected_count));
+
+    FixedVector<std::size_t, TIMER_COUNT> expired{};
+    while (!wheel.empty())
+    {
+        const std::uint64_t target = wheel.now() + STEP;
+        const std::size_t before = expired.size();
+        wheel.advance(target, std::back_inserter(expired));
+        for (std::size_t j = before; j < expired.size(); j++)
+        {
+            const std::uint64_t deadline = handles[expired[j]].first;
+            if (deadline > target || deadline <= target - STEP || deadline != expected[j].first)
+            {
+                return false;
+            }
+        }
+    }
+    return expired.size() == expected_count;
+}
+}  // namespace
+
+TEST(FixedTimerWheel, DefaultConstructor)
+{
+    constexpr TimerWheelType VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.now() == 0);
+    static_assert(VAL1.max_size() == 16);
+    static_assert(!is_full(VAL1));
+
+    constexpr TimerWheelType VAL2{500};
+    static_assert(VAL2.now() == 500);
+}
+
+TEST(FixedTimerWheel, ScheduleAndAdvance)
+{
+    constexpr auto VAL1 = []()
+    {
+        TimerWheelType var{};
+        var.schedule(5, 50);
+        var.schedule(3, 30);
+        var.schedule_after(3, 31);
+        var.schedule(9, 90);
+
+        FixedVector<int, 4> out{};
+        const std::size_t count = var.advance(5, std::back_inserter(out));
+        return std::make_pair(count, out);
+    }();
+
+    static_assert(VAL1.first == 3);
+    static_assert(std::ranges::equal(VAL1.second, std::array{30, 31, 50}));
+
+    TimerWheelType var1{};
+    var1.schedule(5, 50);
+    var1.schedule(9, 90);
+    FixedVector<int, 4> out{};
+    EXPECT_EQ(0, var1.advance(4, std::back_inserter(out)));
+    EXPECT_EQ(4, var1.now());
+    EXPECT_EQ(2, var1.size());
+    EXPECT_EQ(1, var1.advance(8, std::back_inserter(out)));
+    EXPECT_EQ(1, var1.advance(9, std::back_inserter(out)));
+    EXPECT_TRUE(var1.empty());
+    EXPECT_TRUE(std::ranges::equal(out, std::array{50, 90}));
+
+    // Going backwards does nothing
+    EXPECT_EQ(0, var1.advance(3, std::back_inserter(out)));
+    EXPECT_EQ(9, var1.now());
+}
+
+TEST(FixedTimerWheel, PastDeadlineExpiresOnNextTick)
+{
+    TimerWheelType var1{100};
+    var1.schedule(40, 1);
+    var1.schedule(100, 2);
+    FixedVector<int, 4> out{};
+    EXPECT_EQ(2, var1.advance(101, std::back_inserter(out)));
+    EXPECT_TRUE(std::ranges::equal(out, std::array{1, 2}));
+}
+
+TEST(FixedTimerWheel, CancelAndStaleHandles)
+{
+    TimerWheelType var1{};
+    const auto handle1 = var1.schedule(5, 1);
+    const auto handle2 = var1.schedule(6, 2);
+    EXPECT_TRUE(var1.contains(handle1));
+    EXPECT_TRUE(var1.cancel(handle1));
+    EXPECT_FALSE(var1.contains(handle1));
+    EXPECT_FALSE(var1.cancel(handle1));
+    EXPECT_EQ(1, var1.size());
+
+    // The index is reused, but the old handle stays stale
+    const auto handle3 = var1.schedule(7, 3);
+    EXPECT_EQ(handle1.index, handle3.index);
+    EXPECT_FALSE(var1.contains(handle1));
+    EXPECT_FALSE(var1.reschedule(handle1, 8));
+
+    FixedVector<int, 4> out{};
+    var1.advance(10, std::back_inserter(out));
+    EXPECT_TRUE(std::ranges::equal(out, std::array{2, 3}));
+    EXPECT_FALSE(var1.contains(handle2));
+    EXPECT_FALSE(var1.contains(handle3));
+    EXPECT_FALSE(var1.cancel(handle3));
+}
+
+TEST(FixedTimerWheel, Reschedule)
+{
+    TimerWheelType var1{};
+    const auto handle1 = var1.schedule(5, 1);
+    var1.schedule(6, 2);
+    // Into a higher level and back down
+    EXPECT_TRUE(var1.reschedule(handle1, 300));
+    FixedVector<int, 4> out{};
+    var1.advance(10, std::back_inserter(out));
+    EXPECT_TRUE(std::ranges::equal(out, std::array{2}));
+    EXPECT_TRUE(var1.reschedule(handle1, 12));
+    var1.advance(12, std::back_inserter(out));
+    EXPECT_TRUE(std::ranges::equal(out, std::array{2, 1}));
+}
+
+TEST(FixedTimerWheel, CascadesAcrossLevels)
+{
+    // 8 slots, 3 levels: ticks [1, 8) in level 0, [8, 64) in level 1, [64, 512) in level 2
+    static_assert(matches_sorted_deadlines<8, 3, 1>(500));
+    static_assert(matches_sorted_deadlines<8, 3, 37>(500));
+    static_assert(matches_sorted_deadlines<64, 2, 1>(5'000));
+    static_assert(matches_sorted_deadlines<64, 4, 1'000>(1'000'000));
+    // The level-0 slots span a single word of the occupancy bitmap, or more than one
+    static_assert(matches_sorted_deadlines<256, 2, 3>(20'000));
+}
+
+TEST(FixedTimerWheel, BeyondTheSpanOfTheWheel)
+{
+    // Only 8 * 8 = 64 ticks ahead fit in the wheel
+    static_assert(matches_sorted_deadlines<8, 2, 1>(1'000));
+    static_assert(matches_sorted_deadlines<8, 2, 50>(1'000));
+    static_assert(matches_sorted_deadlines<4, 1, 1>(100));
+    static_assert(matches_sorted_deadlines<4, 1, 9>(100));
+
+    FixedTimerWheel<int, 4, 8, 2> var1{};
+    var1.schedule(1'000'000, 1);
+    FixedVector<int, 4> out{};
+    EXPECT_EQ(0, var1.advance(999'999, std::back_inserter(out)));
+    EXPECT_EQ(1, var1.advance(1'000'000, std::back_inserter(out)));
+}
+
+TEST(FixedTimerWheel, Clear)
+{
+    TimerWheelType var1{};
+    const auto handle1 = var1.schedule(5, 1);
+    var1.schedule(500, 2);
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_FALSE(var1.contains(handle1));
+
+    var1.schedule(6, 3);
+    FixedVector<int, 4> out{};
+    var1.advance(1'000, std::back_inserter(out));
+    EXPECT_TRUE(std::ranges::equal(out, std::array{3}));
+}
+
+TEST(FixedTimerWheel, CopyIsACheckpoint)
+{
+    TimerWheelType var1{};
+    var1.schedule(5, 1);
+    var1.schedule(70, 2);
+    const TimerWheelType checkpoint = var1;
+
+    FixedVector<int, 4> out1{};
+    var1.advance(100, std::back_inserter(out1));
+    TimerWheelType var2 = checkpoint;
+    FixedVector<int, 4> out2{};
+    var2.advance(100, std::back_inserter(out2));
+    EXPECT_EQ(out1, out2);
+    EXPECT_TRUE(std::ranges::equal(out2, std::array{1, 2}));
+}
+
+TEST(FixedTimerWheel, Full)
+{
+    FixedTimerWheel<int, 2, 8, 2> var1{};
+    var1.schedule(1, 1);
+    var1.schedule(2, 2);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.schedule(3, 3), "");
+}
+
+}  // namespace fixed_containers
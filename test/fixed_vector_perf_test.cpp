@@ -0,0 +1,139 @@
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+template <std::size_t BYTE_COUNT>
+struct Payload
+{
+    std::array<std::byte, BYTE_COUNT> bytes;
+};
+
+constexpr std::size_t CAPACITY = 1'024;
+
+// Large vectors do not fit comfortably on the stack. `std::vector` gets its capacity upfront, so
+// only the element operations are measured.
+template <typename VectorType>
+std::unique_ptr<VectorType> make_empty_vector()
+{
+    auto instance = std::make_unique<VectorType>();
+    if constexpr (requires { instance->reserve(CAPACITY); })
+    {
+        instance->reserve(CAPACITY);
+    }
+    return instance;
+}
+
+template <typename VectorType>
+std::unique_ptr<VectorType> make_half_full_vector()
+{
+    using T = typename VectorType::value_type;
+    auto instance = make_empty_vector<VectorType>();
+    instance->resize(CAPACITY / 2, T{});
+    return instance;
+}
+
+template <typename VectorType>
+void benchmark_vector_append_range(benchmark::State& state)
+{
+    using T = typename VectorType::value_type;
+    const std::vector<T> source(CAPACITY / 4, T{});
+    auto instance = make_empty_vector<VectorType>();
+
+    for (auto _ : state)
+    {
+        instance->clear();
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            instance->insert(instance->end(), source.begin(), source.end());
+        }
+        benchmark::DoNotOptimize(instance->data());
+    }
+}
+
+template <typename VectorType>
+void benchmark_vector_insert_middle(benchmark::State& state)
+{
+    using T = typename VectorType::value_type;
+    auto instance = make_half_full_vector<VectorType>();
+    const T value{};
+
+    for (auto _ : state)
+    {
+        instance->insert(std::next(instance->begin(), CAPACITY / 4), value);
+        instance->pop_back();
+        benchmark::DoNotOptimize(instance->data());
+    }
+}
+
+template <typename VectorType>
+void benchmark_vector_erase_middle(benchmark::State& state)
+{
+    using T = typename VectorType::value_type;
+    auto instance = make_half_full_vector<VectorType>();
+    const T value{};
+
+    for (auto _ : state)
+    {
+        instance->erase(std::next(instance->begin(), CAPACITY / 4));
+        instance->push_back(value);
+        benchmark::DoNotOptimize(instance->data());
+    }
+}
+
+// Drops every tenth element, then refills the vector
+template <typename VectorType>
+void benchmark_vector_erase_if(benchmark::State& state)
+{
+    using T = typename VectorType::value_type;
+    auto instance = make_half_full_vector<VectorType>();
+
+    for (auto _ : state)
+    {
+        std::size_t i = 0;
+        erase_if(*instance, [&i](const T& /*entry*/) { return (i++ % 10) == 0; });
+        instance->resize(CAPACITY / 2, T{});
+        benchmark::DoNotOptimize(instance->data());
+    }
+}
+
+BENCHMARK(benchmark_vector_append_range<std::vector<Payload<8>>>);
+BENCHMARK(benchmark_vector_append_range<FixedVector<Payload<8>, CAPACITY>>);
+BENCHMARK(benchmark_vector_append_range<std::vector<Payload<64>>>);
+BENCHMARK(benchmark_vector_append_range<FixedVector<Payload<64>, CAPACITY>>);
+BENCHMARK(benchmark_vector_append_range<std::vector<Payload<256>>>);
+BENCHMARK(benchmark_vector_append_range<FixedVector<Payload<256>, CAPACITY>>);
+
+BENCHMARK(benchmark_vector_insert_middle<std::vector<Payload<8>>>);
+BENCHMARK(benchmark_vector_insert_middle<FixedVector<Payload<8>, CAPACITY>>);
+BENCHMARK(benchmark_vector_insert_middle<std::vector<Payload<64>>>);
+BENCHMARK(benchmark_vector_insert_middle<FixedVector<Payload<64>, CAPACITY>>);
+BENCHMARK(benchmark_vector_insert_middle<std::vector<Payload<256>>>);
+BENCHMARK(benchmark_vector_insert_middle<FixedVector<Payload<256>, CAPACITY>>);
+
+BENCHMARK(benchmark_vector_erase_middle<std::vector<Payload<8>>>);
+BENCHMARK(benchmark_vector_erase_middle<FixedVector<Payload<8>, CAPACITY>>);
+BENCHMARK(benchmark_vector_erase_middle<std::vector<Payload<64>>>);
+BENCHMARK(benchmark_vector_erase_middle<FixedVector<Payload<64>, CAPACITY>>);
+BENCHMARK(benchmark_vector_erase_middle<std::vector<Payload<256>>>);
+BENCHMARK(benchmark_vector_erase_middle<FixedVector<Payload<256>, CAPACITY>>);
+
+BENCHMARK(benchmark_vector_erase_if<std::vector<Payload<8>>>);
+BENCHMARK(benchmark_vector_erase_if<FixedVector<Payload<8>, CAPACITY>>);
+BENCHMARK(benchmark_vector_erase_if<std::vector<Payload<64>>>);
+BENCHMARK(benchmark_vector_erase_if<FixedVector<Payload<64>, CAPACITY>>);
+BENCHMARK(benchmark_vector_erase_if<std::vector<Payload<256>>>);
+BENCHMARK(benchmark_vector_erase_if<FixedVector<Payload<256>, CAPACITY>>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
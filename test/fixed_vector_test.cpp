@@ -6,14 +6,18 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <ranges>
@@ -64,6 +68,13 @@ static_assert(std::is_same_v<int, typename ConstVecType::iterator::value_type>);
 static_assert(std::is_same_v<int, typename ConstVecType::const_iterator::value_type>);
 }  // namespace trivially_copyable_vector
 
+// The size is stored in the smallest type that fits
+static_assert(std::is_same_v<std::size_t, FixedVector<std::uint8_t, 6>::size_type>);
+static_assert(consteval_compare::equal<7, sizeof(FixedVector<std::uint8_t, 6>)>);
+static_assert(consteval_compare::equal<258, sizeof(FixedVector<std::uint8_t, 256>)>);
+static_assert(consteval_compare::equal<24, sizeof(FixedVector<int, 5>)>);
+static_assert(consteval_compare::equal<48, sizeof(FixedVector<std::size_t, 5>)>);
+
 namespace trivially_copyable_but_not_copyable_or_moveable_vector
 {
 using VecType = FixedVector<MockTriviallyCopyableButNotCopyableOrMoveable, 5>;
@@ -135,8 +146,40 @@ struct ComplexStruct
     int c;
 };
 
+// Owns a heap allocation so it is not trivially copyable, but holds no pointers into itself
+struct RelocatableHandle
+{
+    std::unique_ptr<int> value;
+    int* move_count;
+
+    RelocatableHandle(int initial_value, int* move_count_param)
+      : value(std::make_unique<int>(initial_value))
+      , move_count(move_count_param)
+    {
+    }
+    RelocatableHandle(const RelocatableHandle&) = delete;
+    RelocatableHandle(RelocatableHandle&& other) noexcept
+      : value(std::move(other.value))
+      , move_count(other.move_count)
+    {
+        ++*move_count;
+    }
+    RelocatableHandle& operator=(const RelocatableHandle&) = delete;
+    RelocatableHandle& operator=(RelocatableHandle&& other) noexcept
+    {
+        value = std::move(other.value);
+        move_count = other.move_count;
+        ++*move_count;
+        return *this;
+    }
+    ~RelocatableHandle() = default;
+};
+
 }  // namespace
 
+template <>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE<RelocatableHandle> = true;
+
 TEST(FixedVector, DefaultConstructor)
 {
     constexpr FixedVector<int, 8> VAL1{};
@@ -892,6 +935,54 @@ TEST(FixedVector, Comparison)
     }
 }
 
+TEST(FixedVector, ZeroUnusedTail)
+{
+    {
+        using ZeroedVector =
+            FixedVector<int, 8, customize::SequenceContainerZeroUnusedTailAbortChecking<int, 8>>;
+
+        ZeroedVector var1{1, 2, 3, 4, 5, 6};
+        var1.erase(std::next(var1.begin(), 1), std::next(var1.begin(), 3));
+        var1.pop_back();
+        EXPECT_TRUE(std::all_of(std::next(var1.data(), 3),
+                                std::next(var1.data(), 8),
+                                [](const int value) { return value == 0; }));
+
+        const ZeroedVector var2{1, 4, 5};
+        EXPECT_EQ(var1, var2);
+        var1.push_back(0);
+        EXPECT_NE(var1, var2);
+        EXPECT_GT(var1, var2);
+        var1.clear();
+        EXPECT_EQ(ZeroedVector{}, var1);
+
+        static_assert(ZeroedVector{1, 2} == ZeroedVector{1, 2});
+    }
+
+    {
+        using ZeroedVector = FixedVector<std::uint8_t,
+                                         12,
+                                         customize::SequenceContainerZeroUnusedTailAbortChecking<
+                                             std::uint8_t,
+                                             12>>;
+        const std::vector<std::vector<std::uint8_t>> values{
+            {}, {0}, {1}, {1, 2}, {1, 2, 0}, {1, 3}, {255}, {1, 2, 3, 4, 5, 6, 7, 8, 9}};
+        for (const auto& lhs : values)
+        {
+            for (const auto& rhs : values)
+            {
+                ZeroedVector lhs_vector(lhs.begin(), lhs.end());
+                // Leave stale elements behind, to be zeroed
+                lhs_vector.resize(10, 7);
+                lhs_vector.resize(lhs.size());
+                const ZeroedVector rhs_vector(rhs.begin(), rhs.end());
+                EXPECT_EQ(lhs == rhs, lhs_vector == rhs_vector);
+                EXPECT_EQ(lhs <=> rhs, lhs_vector <=> rhs_vector);
+            }
+        }
+    }
+}
+
 TEST(FixedVector, IteratorAssignment)
 {
     const FixedVector<int, 8>::iterator mutable_it;  // Default construction
@@ -1212,6 +1303,72 @@ TEST(FixedVector, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+TEST(FixedVector, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 1, 2};
+        var.resize_for_overwrite(5);
+        var[3] = 3;
+        var[4] = 4;
+        var.resize_for_overwrite(4);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3}));
+
+    FixedVector<std::uint8_t, 64> var2{};
+    var2.resize_for_overwrite(3);
+    const std::array<std::uint8_t, 3> received{7, 8, 9};
+    std::copy(received.begin(), received.end(), var2.data());
+    EXPECT_TRUE(std::ranges::equal(var2, received));
+
+    {
+        FixedVector<MockNonTrivialInt, 5> var{};
+        var.resize_for_overwrite(5);
+        EXPECT_EQ(var.size(), 5);
+        var.resize_for_overwrite(1);
+        EXPECT_EQ(var.size(), 1);
+    }
+
+    EXPECT_DEATH(var2.resize_for_overwrite(65), "");
+}
+
+TEST(FixedVector, AppendWith)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 1};
+        var.append_with(4,
+                        [](int* first, const std::size_t count)
+                        {
+                            // Only fills 2 out of the 4 elements
+                            std::fill_n(first, count / 2, 5);
+                            return count / 2;
+                        });
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 5, 5}));
+
+    FixedVector<std::uint8_t, 8> var2{1};
+    var2.append_with(7,
+                     [](std::uint8_t* first, const std::size_t count)
+                     {
+                         std::fill_n(first, count, std::uint8_t{2});
+                         return count;
+                     });
+    EXPECT_TRUE(std::ranges::equal(var2, std::array<std::uint8_t, 8>{1, 2, 2, 2, 2, 2, 2, 2}));
+    var2.clear();
+    const auto writes_none = [](std::uint8_t* /*first*/, std::size_t /*count*/) { return 0; };
+    const auto writes_three = [](std::uint8_t* /*first*/, std::size_t /*count*/) { return 3; };
+    var2.append_with(3, writes_none);
+    EXPECT_TRUE(var2.empty());
+
+    EXPECT_DEATH(var2.append_with(9, writes_none), "");
+    EXPECT_DEATH(var2.append_with(2, writes_three), "");
+}
+
 TEST(FixedVector, Size)
 {
     {
@@ -1666,6 +1823,32 @@ TEST(FixedVector, EraseRange)
     }
 }
 
+TEST(FixedVector, TriviallyRelocatableElements)
+{
+    static_assert(TriviallyRelocatable<FixedVector<int, 5>>);
+    static_assert(NotTriviallyRelocatable<FixedVector<std::vector<int>, 5>>);
+    static_assert(NotTriviallyCopyable<RelocatableHandle>);
+    static_assert(TriviallyRelocatable<FixedVector<RelocatableHandle, 5>>);
+
+    int move_count = 0;
+    FixedVector<RelocatableHandle, 8> var{};
+    for (int i = 0; i < 6; i++)
+    {
+        var.emplace_back(i, &move_count);
+    }
+    ASSERT_EQ(0, move_count);
+
+    // Shifting the elements relocates them without calling their move constructor
+    var.emplace(var.begin(), 10, &move_count);
+    var.erase(std::next(var.begin(), 2), std::next(var.begin(), 4));
+    var.erase(std::next(var.begin(), 3));
+    EXPECT_EQ(0, move_count);
+
+    const auto values =
+        var | std::views::transform([](const auto& handle) { return *handle.value; });
+    EXPECT_TRUE(std::ranges::equal(values, std::array{10, 0, 3, 5}));
+}
+
 TEST(FixedVector, EraseOne)
 {
     constexpr auto VAL1 = []()
@@ -1779,6 +1962,70 @@ TEST(FixedVector, EraseIf)
     }();
 
     static_assert(std::ranges::equal(VAL1, std::array<int, 3>{1, 3, 5}));
+
+    {
+        FixedVector<int, 16> var{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+        const auto is_removed = [](const int& entry) { return (entry % 4) == 1 || entry > 12; };
+        EXPECT_EQ(6, erase_if(var, is_removed));
+        EXPECT_TRUE(std::ranges::equal(var, std::array{0, 2, 3, 4, 6, 7, 8, 10, 11, 12}));
+        EXPECT_EQ(10, erase_if(var, [](const int& /*entry*/) { return true; }));
+        EXPECT_TRUE(var.empty());
+    }
+
+    {
+        // Trivially relocatable, but owns memory: leaks and double-frees are caught by sanitizers
+        int move_count = 0;
+        FixedVector<RelocatableHandle, 8> var{};
+        for (int i = 0; i < 8; i++)
+        {
+            var.emplace_back(i, &move_count);
+        }
+        const std::size_t removed_count =
+            erase_if(var, [](const RelocatableHandle& entry) { return *entry.value < 2; });
+        EXPECT_EQ(2, removed_count);
+        EXPECT_EQ(6, var.size());
+        EXPECT_EQ(2, *var.front().value);
+        EXPECT_EQ(7, *var.back().value);
+        EXPECT_EQ(0, move_count);
+    }
+
+    {
+        FixedVector<std::unique_ptr<int>, 8> var{};
+        for (int i = 0; i < 8; i++)
+        {
+            var.push_back(std::make_unique<int>(i));
+        }
+        erase_if(var, [](const std::unique_ptr<int>& entry) { return (*entry % 3) == 0; });
+        EXPECT_EQ(5, var.size());
+        EXPECT_EQ(1, *var.front());
+        EXPECT_EQ(7, *var.back());
+    }
+}
+
+TEST(FixedVector, UnorderedErase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2, 3, 4};
+        auto it = var.unordered_erase(std::next(var.begin(), 1));
+        assert_or_abort(*it == 4);
+        it = var.unordered_erase(std::prev(var.end()));
+        assert_or_abort(it == var.end());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 4, 2}));
+
+    FixedVector<std::unique_ptr<int>, 4> var2{};
+    var2.push_back(std::make_unique<int>(1));
+    var2.push_back(std::make_unique<int>(2));
+    var2.push_back(std::make_unique<int>(3));
+    var2.unordered_erase(var2.begin());
+    EXPECT_EQ(2, var2.size());
+    EXPECT_EQ(3, *var2.front());
+    EXPECT_EQ(2, *var2.back());
+
+    EXPECT_DEATH(var2.unordered_erase(var2.end()), "");
 }
 
 TEST(FixedVector, Front)
@@ -0,0 +1,208 @@
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_work_stealing_deque.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t DEQUE_CAPACITY = 1'024;
+constexpr std::uint32_t ELEMENT_COUNT = 1 << 22;
+constexpr std::uint32_t GRAIN_SIZE = 1 << 10;
+
+// The baseline: a FixedDeque guarded by a spinlock
+template <typename T, std::size_t MAXIMUM_SIZE>
+class SpinlockGuardedDeque
+{
+    class Lock
+    {
+        std::atomic_flag& flag_;
+
+    public:
+        explicit Lock(std::atomic_flag& flag)
+          : flag_{flag}
+        {
+            while (flag_.test_and_set(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+        }
+        Lock(const Lock&) = delete;
+        Lock& operator=(const Lock&) = delete;
+        ~Lock() { flag_.clear(std::memory_order_release); }
+    };
+
+    std::atomic_flag flag_{};
+    FixedDeque<T, MAXIMUM_SIZE> deque_{};
+
+public:
+    bool push_bottom(const T& value)
+    {
+        const Lock lock{flag_};
+        if (is_full(deque_))
+        {
+            return false;
+        }
+        deque_.push_back(value);
+        return true;
+    }
+    std::optional<T> pop_bottom()
+    {
+        const Lock lock{flag_};
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{deque_.back()};
+        deque_.pop_back();
+        return out;
+    }
+    std::optional<T> steal()
+    {
+        const Lock lock{flag_};
+        if (deque_.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<T> out{deque_.front()};
+        deque_.pop_front();
+        return out;
+    }
+};
+
+// A task is the range [begin, end) of the input, packed into an integer so that it fits the
+// lock-free elements of the deque
+struct Range
+{
+    std::uint32_t begin;
+    std::uint32_t end;
+
+    static constexpr Range unpack(const std::uint64_t task)
+    {
+        return {static_cast<std::uint32_t>(task >> 32U), static_cast<std::uint32_t>(task)};
+    }
+    [[nodiscard]] constexpr std::uint64_t pack() const
+    {
+        return (static_cast<std::uint64_t>(begin) << 32U) | end;
+    }
+};
+
+// Fork-join sum: a task larger than `GRAIN_SIZE` forks its right half into the worker's own deque
+// and continues with its left half. Idle workers steal from a pseudo-random other worker.
+template <typename DequeType>
+class TreeSum
+{
+    const std::vector<std::uint64_t>& input_;
+    std::vector<std::unique_ptr<DequeType>> deques_{};
+    std::atomic<std::uint64_t> remaining_element_count_;
+    std::atomic<std::uint64_t> sum_{0};
+
+public:
+    TreeSum(const std::vector<std::uint64_t>& input, const std::size_t worker_count)
+      : input_{input}
+      , remaining_element_count_{input.size()}
+    {
+        for (std::size_t i = 0; i < worker_count; i++)
+        {
+            deques_.push_back(std::make_unique<DequeType>());
+        }
+    }
+
+    std::uint64_t run()
+    {
+        // A fresh deque always has room
+        const Range whole_input{0, static_cast<std::uint32_t>(input_.size())};
+        [[maybe_unused]] const bool pushed = deques_.front()->push_bottom(whole_input.pack());
+
+        std::vector<std::thread> threads{};
+        for (std::size_t i = 1; i < deques_.size(); i++)
+        {
+            threads.emplace_back([this, i]() { work(i); });
+        }
+        work(0);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        return sum_.load();
+    }
+
+private:
+    void work(const std::size_t worker_index)
+    {
+        DequeType& own = *deques_[worker_index];
+        std::uint64_t random_state = worker_index + 1;
+        std::uint64_t local_sum = 0;
+
+        while (remaining_element_count_.load(std::memory_order_acquire) > 0)
+        {
+            std::optional<std::uint64_t> task = own.pop_bottom();
+            if (!task.has_value())
+            {
+                // xorshift
+                random_state ^= random_state << 13U;
+                random_state ^= random_state >> 7U;
+                random_state ^= random_state << 17U;
+                task = deques_[random_state % deques_.size()]->steal();
+            }
+            if (!task.has_value())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            Range range = Range::unpack(*task);
+            while (range.end - range.begin > GRAIN_SIZE)
+            {
+                const std::uint32_t middle = range.begin + ((range.end - range.begin) / 2);
+                if (!own.push_bottom(Range{middle, range.end}.pack()))
+                {
+                    // Full: keep the whole range
+                    break;
+                }
+                range.end = middle;
+            }
+            local_sum = std::accumulate(std::next(input_.begin(), range.begin),
+                                        std::next(input_.begin(), range.end),
+                                        local_sum);
+            remaining_element_count_.fetch_sub(range.end - range.begin, std::memory_order_release);
+        }
+        sum_.fetch_add(local_sum, std::memory_order_relaxed);
+    }
+};
+
+template <typename DequeType>
+void benchmark_tree_sum(benchmark::State& state)
+{
+    const auto worker_count = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint64_t> input(ELEMENT_COUNT);
+    std::iota(input.begin(), input.end(), 0);
+
+    for (auto _ : state)
+    {
+        TreeSum<DequeType> tree_sum{input, worker_count};
+        benchmark::DoNotOptimize(tree_sum.run());
+    }
+    state.SetItemsProcessed(state.iterations() * ELEMENT_COUNT);
+}
+
+using SpinlockDeque = SpinlockGuardedDeque<std::uint64_t, DEQUE_CAPACITY>;
+using WorkStealingDeque = FixedWorkStealingDeque<std::uint64_t, DEQUE_CAPACITY>;
+
+BENCHMARK(benchmark_tree_sum<SpinlockDeque>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(benchmark_tree_sum<WorkStealingDeque>)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+#include "fixed_containers/fixed_work_stealing_deque.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using WorkStealingDequeType = FixedWorkStealingDeque<int*, 5>;
+static_assert(StandardLayout<WorkStealingDequeType>);
+static_assert(!std::is_copy_constructible_v<WorkStealingDequeType>);
+static_assert(!std::is_move_constructible_v<WorkStealingDequeType>);
+static_assert(WorkStealingDequeType::static_max_size() == 5);
+}  // namespace
+
+TEST(FixedWorkStealingDeque, DefaultConstructor)
+{
+    const FixedWorkStealingDeque<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(8, var1.max_size());
+}
+
+TEST(FixedWorkStealingDeque, OwnerIsLifoAndThievesAreFifo)
+{
+    FixedWorkStealingDeque<int, 8> var1{};
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(var1.push_bottom(i));
+    }
+    EXPECT_EQ(5, var1.size());
+
+    EXPECT_EQ(4, var1.pop_bottom());
+    EXPECT_EQ(0, var1.steal());
+    EXPECT_EQ(1, var1.steal());
+    EXPECT_EQ(3, var1.pop_bottom());
+    EXPECT_EQ(2, var1.pop_bottom());
+    EXPECT_EQ(std::nullopt, var1.pop_bottom());
+    EXPECT_EQ(std::nullopt, var1.steal());
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedWorkStealingDeque, Overflow)
+{
+    // A capacity that is not a power of two, so that the indices wrap around with a division
+    FixedWorkStealingDeque<int, 3> var1{};
+    for (int round = 0; round < 4; round++)
+    {
+        EXPECT_TRUE(var1.push_bottom(round));
+        EXPECT_TRUE(var1.push_bottom(round + 1));
+        EXPECT_TRUE(var1.push_bottom(round + 2));
+        EXPECT_FALSE(var1.push_bottom(99));
+        EXPECT_EQ(3, var1.size());
+
+        // Stealing makes room at the top
+        EXPECT_EQ(round, var1.steal());
+        EXPECT_TRUE(var1.push_bottom(round + 3));
+        EXPECT_FALSE(var1.push_bottom(99));
+
+        EXPECT_EQ(round + 3, var1.pop_bottom());
+        EXPECT_EQ(round + 1, var1.steal());
+        EXPECT_EQ(round + 2, var1.pop_bottom());
+        EXPECT_TRUE(var1.empty());
+    }
+}
+
+TEST(FixedWorkStealingDeque, OwnerAndThieves)
+{
+    static constexpr std::size_t THIEF_COUNT = 3;
+    static constexpr std::uint64_t ELEMENT_COUNT = 50'000;
+    FixedWorkStealingDeque<std::uint64_t, 16> var1{};
+
+    std::atomic<bool> done{false};
+    std::atomic<std::uint64_t> stolen_sum{0};
+    std::atomic<std::uint64_t> stolen_count{0};
+    std::vector<std::thread> thieves{};
+    for (std::size_t i = 0; i < THIEF_COUNT; i++)
+    {
+        thieves.emplace_back(
+            [&]()
+            {
+                while (!done.load(std::memory_order_acquire))
+                {
+                    if (const std::optional<std::uint64_t> value = var1.steal())
+                    {
+                        stolen_sum.fetch_add(*value, std::memory_order_relaxed);
+                        stolen_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    // Every element is taken exactly once, either by the owner or by a thief
+    std::uint64_t popped_sum = 0;
+    std::uint64_t popped_count = 0;
+    for (std::uint64_t value = 1; value <= ELEMENT_COUNT; value++)
+    {
+        while (!var1.push_bottom(value))
+        {
+            std::this_thread::yield();
+        }
+        if (value % 3 == 0)
+        {
+            while (const std::optional<std::uint64_t> popped = var1.pop_bottom())
+            {
+                popped_sum += *popped;
+                popped_count++;
+            }
+        }
+    }
+    while (const std::optional<std::uint64_t> popped = var1.pop_bottom())
+    {
+        popped_sum += *popped;
+        popped_count++;
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+
+    EXPECT_EQ(ELEMENT_COUNT, popped_count + stolen_count.load());
+    EXPECT_EQ(ELEMENT_COUNT * (ELEMENT_COUNT + 1) / 2, popped_sum + stolen_sum.load());
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace fixed_containers
 {
@@ -40,4 +42,15 @@ TEST(IntMath, Add)
     static_assert(6ULL == int_math::safe_add(15ULL, -9).cast<std::size_t>());
 }
 
+TEST(IntMath, SmallestUnsignedIntegralFor)
+{
+    static_assert(std::is_same_v<std::uint8_t, int_math::SmallestUnsignedIntegralFor<0>>);
+    static_assert(std::is_same_v<std::uint8_t, int_math::SmallestUnsignedIntegralFor<255>>);
+    static_assert(std::is_same_v<std::uint16_t, int_math::SmallestUnsignedIntegralFor<256>>);
+    static_assert(std::is_same_v<std::uint16_t, int_math::SmallestUnsignedIntegralFor<65'535>>);
+    static_assert(std::is_same_v<std::uint32_t, int_math::SmallestUnsignedIntegralFor<65'536>>);
+    static_assert(
+        std::is_same_v<std::size_t, int_math::SmallestUnsignedIntegralFor<(1ULL << 32U)>>);
+}
+
 }  // namespace fixed_containers
@@ -430,8 +430,27 @@ public:
 static_assert(alignof(MockAligned64) == 64);
 static_assert(sizeof(MockAligned64) == 64);
 
+// `<=>` orders ascending, but `std::less` is specialized below to order descending
+struct MockLessSpecializedInt
+{
+    int value;
+
+    constexpr bool operator==(const MockLessSpecializedInt& other) const = default;
+    constexpr std::strong_ordering operator<=>(const MockLessSpecializedInt& other) const = default;
+};
+
 }  // namespace fixed_containers
 
+template <>
+struct std::less<fixed_containers::MockLessSpecializedInt>
+{
+    constexpr bool operator()(const fixed_containers::MockLessSpecializedInt& lhs,
+                              const fixed_containers::MockLessSpecializedInt& rhs) const
+    {
+        return lhs.value > rhs.value;
+    }
+};
+
 template <>
 struct std::hash<fixed_containers::MockFailingAddressOfOperator>
 {
@@ -0,0 +1,167 @@
+#include "fixed_containers/string_search.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+// The bytes past the haystack are readable and deliberately contain the searched characters, to
+// catch matches that are not discarded.
+constexpr std::size_t BUFFER_SIZE = 72;
+using Buffer = std::array<char, BUFFER_SIZE>;
+
+Buffer make_buffer(const std::string_view contents)
+{
+    Buffer buffer{};
+    buffer.fill('a');
+    for (std::size_t i = 0; i < contents.size(); i++)
+    {
+        buffer.at(i) = contents[i];
+    }
+    return buffer;
+}
+
+constexpr std::string_view CONTENTS =
+    "xaxbbcabcabxcd efghabcdabcijk  lmnopqrstabcuvwxyzabc012345\t6789abcq";
+
+// Runs `function(haystack, readable_length)` on every prefix of `CONTENTS`, with both the whole
+// buffer being readable and only the haystack itself being readable.
+template <class Function>
+void for_each_haystack(const Function& function)
+{
+    const Buffer buffer = make_buffer(CONTENTS);
+    for (std::size_t length = 0; length <= CONTENTS.size(); length++)
+    {
+        const std::string_view haystack{buffer.data(), length};
+        function(haystack, BUFFER_SIZE);
+        function(haystack, length);
+    }
+}
+}  // namespace
+
+TEST(StringSearch, FindCharacter)
+{
+    static_assert(string_search::find("abcabc", 6, 'c', 0) == 2);
+    static_assert(string_search::find("abcabc", 6, 'c', 3) == 5);
+    static_assert(string_search::find("abcabc", 6, 'd', 0) == std::string_view::npos);
+
+    for_each_haystack(
+        [](const std::string_view haystack, const std::size_t readable_length)
+        {
+            for (const char character : std::string_view{"axcq9\t "})
+            {
+                for (std::size_t pos = 0; pos <= haystack.size() + 1; pos++)
+                {
+                    EXPECT_EQ(haystack.find(character, pos),
+                              string_search::find(haystack, readable_length, character, pos));
+                }
+            }
+        });
+}
+
+TEST(StringSearch, RFindCharacter)
+{
+    static_assert(string_search::rfind("abcabc", 6, 'c', std::string_view::npos) == 5);
+    static_assert(string_search::rfind("abcabc", 6, 'c', 4) == 2);
+    static_assert(string_search::rfind("abcabc", 6, 'd', 5) == std::string_view::npos);
+
+    for_each_haystack(
+        [](const std::string_view haystack, const std::size_t readable_length)
+        {
+            for (const char character : std::string_view{"axcq9\t "})
+            {
+                for (std::size_t pos = 0; pos <= haystack.size() + 1; pos++)
+                {
+                    EXPECT_EQ(haystack.rfind(character, pos),
+                              string_search::rfind(haystack, readable_length, character, pos));
+                }
+                EXPECT_EQ(haystack.rfind(character),
+                          string_search::rfind(
+                              haystack, readable_length, character, std::string_view::npos));
+            }
+        });
+}
+
+TEST(StringSearch, FindSubstring)
+{
+    static_assert(string_search::find("abcabc", 6, "ca", 0) == 2);
+    static_assert(string_search::find("abcabc", 6, "", 6) == 6);
+    static_assert(string_search::find("abcabc", 6, "abcd", 0) == std::string_view::npos);
+
+    for_each_haystack(
+        [](const std::string_view haystack, const std::size_t readable_length)
+        {
+            for (const std::string_view needle : {std::string_view{""},
+                                                  std::string_view{"a"},
+                                                  std::string_view{"ab"},
+                                                  std::string_view{"abc"},
+                                                  std::string_view{"abcq"},
+                                                  std::string_view{"xy"},
+                                                  std::string_view{"c  l"},
+                                                  std::string_view{"aa"},
+                                                  std::string_view{"abcuvwxyzabc012345"}})
+            {
+                for (std::size_t pos = 0; pos <= haystack.size() + 1; pos++)
+                {
+                    EXPECT_EQ(haystack.find(needle, pos),
+                              string_search::find(haystack, readable_length, needle, pos));
+                }
+            }
+        });
+}
+
+TEST(StringSearch, FindFirstOf)
+{
+    static_assert(string_search::find_first_of("abcabc", 6, "dc", 0) == 2);
+    static_assert(string_search::find_first_of("abcabc", 6, "", 0) == std::string_view::npos);
+
+    for_each_haystack(
+        [](const std::string_view haystack, const std::size_t readable_length)
+        {
+            for (const std::string_view characters : {std::string_view{""},
+                                                      std::string_view{"a"},
+                                                      std::string_view{"qz"},
+                                                      std::string_view{"\t 9"},
+                                                      std::string_view{"0123456789"},
+                                                      std::string_view{"bcdefghijklmnop"}})
+            {
+                for (std::size_t pos = 0; pos <= haystack.size() + 1; pos++)
+                {
+                    EXPECT_EQ(
+                        haystack.find_first_of(characters, pos),
+                        string_search::find_first_of(haystack, readable_length, characters, pos));
+                }
+            }
+        });
+}
+
+TEST(StringSearch, FindFirstNotOf)
+{
+    static_assert(string_search::find_first_not_of("abcabc", 6, "ab", 0) == 2);
+    static_assert(string_search::find_first_not_of("abcabc", 6, "", 1) == 1);
+
+    for_each_haystack(
+        [](const std::string_view haystack, const std::size_t readable_length)
+        {
+            for (const std::string_view characters : {std::string_view{""},
+                                                      std::string_view{"x"},
+                                                      std::string_view{"abcx"},
+                                                      std::string_view{"abcdx"},
+                                                      std::string_view{"abcdefghijklmx "}})
+            {
+                for (std::size_t pos = 0; pos <= haystack.size() + 1; pos++)
+                {
+                    EXPECT_EQ(haystack.find_first_not_of(characters, pos),
+                              string_search::find_first_not_of(
+                                  haystack, readable_length, characters, pos));
+                }
+            }
+        });
+}
+
+}  // namespace fixed_containers